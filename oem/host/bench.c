@@ -0,0 +1,27 @@
+/* oem/host/bench.c */
+#include "benchmark.h"
+#include "entity.h"
+#include <stdio.h>
+
+//
+// Host Benchmarks
+// Runs the boot-time benchmarks (built with ENABLE_BENCHMARKS=1 and
+// ENTITY_CAPACITY=128 so no case is skipped) and prints them through
+// Benchmark_ExportUart. Cycles are host time scaled to 84 MHz: they rank the
+// cases and show the scaling, they are not Cortex-M4 cycle counts.
+//
+int main(void)
+{
+    Benchmark_RunEntityScaling();
+    Benchmark_RunProjectiles();
+
+    int ok = Benchmark_ExportUart();
+    const BenchResult_t *r = Benchmark_GetResults();
+    for (int c = 0; c < BENCH_CASES; c++) {
+        if (r[c].skipped || r[c].ai_cycles == 0) ok = 0;
+    }
+    if (Benchmark_GetProjectileResult()->step_cycles == 0) ok = 0;
+
+    printf(ok ? "bench: ok\n" : "bench: FAILED\n");
+    return ok ? 0 : 1;
+}
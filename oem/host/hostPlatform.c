@@ -0,0 +1,161 @@
+/* oem/host/hostPlatform.c */
+#include "main.h"
+#include "cmsis_os2.h"
+#include "task.h"
+#include "i2c.h"
+#include "flashStore.h"
+#include "appConfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//
+// Host Platform
+// The pieces of the board the host-compiled engine calls into: the DWT clock,
+// GPIO reads, the OLED's I2C link, the RTOS and the flash store. Everything
+// is single threaded and immediate; sectors 6 and 7 are a byte array under
+// the real flash store, so records, compaction and power cuts behave as on
+// the chip.
+//
+
+uint32_t SystemCoreClock = 84000000u;
+CoreDebug_Type Host_CoreDebug;
+GPIO_TypeDef Host_GpioA, Host_GpioC;
+
+// ==================== Core ====================
+
+static uint32_t clock_scale = 1;
+
+void Host_SetClockScale(uint32_t scale)
+{
+    clock_scale = scale ? scale : 1;
+}
+
+DWT_Type *Host_Dwt(void)
+{
+    static DWT_Type dwt;
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t ns = (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+    dwt.CYCCNT = (uint32_t)(ns * (SystemCoreClock / 1000000u) / 1000u * clock_scale);
+    return &dwt;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return Host_Dwt()->CYCCNT / (SystemCoreClock / 1000u);
+}
+
+void HAL_Delay(uint32_t ms)
+{
+    (void)ms;
+}
+
+void Error_Handler(void)
+{
+    fprintf(stderr, "Error_Handler\n");
+    abort();
+}
+
+// Buttons idle high (released)
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin)
+{
+    (void)port;
+    (void)pin;
+    return GPIO_PIN_SET;
+}
+
+// Exports land on stdout
+UART_HandleTypeDef huart2;
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size, uint32_t timeout)
+{
+    (void)huart;
+    (void)timeout;
+    return fwrite(data, 1, size, stdout) == size ? HAL_OK : HAL_ERROR;
+}
+
+// ==================== RTOS ====================
+
+osKernelState_t osKernelGetState(void) { return osKernelInactive; }
+osMutexId_t osMutexNew(const void *attr) { (void)attr; return (osMutexId_t)1; }
+osStatus_t osMutexAcquire(osMutexId_t mutex, uint32_t timeout) { (void)mutex; (void)timeout; return osOK; }
+osStatus_t osMutexRelease(osMutexId_t mutex) { (void)mutex; return osOK; }
+osThreadId_t osThreadGetId(void) { return NULL; }
+uint32_t osThreadFlagsSet(osThreadId_t thread, uint32_t flags) { (void)thread; return flags; }
+void vTaskDelay(TickType_t ticks) { (void)ticks; }
+
+// The task table lives in tasks.c, which is target only
+appStatus_t createTasks(void)
+{
+    return APP_STATUS_OK;
+}
+
+// ==================== OLED ====================
+
+SemaphoreHandle_t i2c_mutex = NULL;
+
+void I2C_Init(void) {}
+
+HAL_StatusTypeDef I2C_Write_Locked(uint8_t devAddr, uint8_t *pData, uint16_t size)
+{
+    (void)devAddr;
+    (void)pData;
+    (void)size;
+    return HAL_OK;
+}
+
+// ==================== Flash ====================
+
+// Sectors 6 and 7 back to back, as on the chip; the real flashStore.c runs on top
+static uint8_t  flash_mem[2 * FLASH_STORE_SECTOR_SIZE];
+static uint8_t  flash_ready = 0;
+static uint32_t flash_cut_at = 0;
+static uint8_t  flash_cut = 0;      // The power is off: nothing programs or erases
+
+void Host_FlashWipe(void)
+{
+    memset(flash_mem, 0xFF, sizeof(flash_mem));
+    flash_ready = 1;
+}
+
+void Host_FlashCutAt(uint32_t address)
+{
+    flash_cut_at = address;
+    flash_cut = 0;
+}
+
+void *Host_FlashPtr(uint32_t address)
+{
+    if (!flash_ready) Host_FlashWipe();
+    if (address < FLASH_STORE_SECTOR_A || address >= FLASH_STORE_SECTOR_A + sizeof(flash_mem)) {
+        fprintf(stderr, "flash: 0x%08x is outside sectors 6/7\n", address);
+        abort();
+    }
+    return &flash_mem[address - FLASH_STORE_SECTOR_A];
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void) { return HAL_OK; }
+HAL_StatusTypeDef HAL_FLASH_Lock(void) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *erase, uint32_t *sector_error)
+{
+    if (flash_cut) return HAL_ERROR;
+
+    uint32_t base = (erase->Sector == FLASH_SECTOR_6) ? FLASH_STORE_SECTOR_A : FLASH_STORE_SECTOR_B;
+    memset(Host_FlashPtr(base), 0xFF, FLASH_STORE_SECTOR_SIZE);
+    *sector_error = 0xFFFFFFFFu;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t type, uint32_t address, uint64_t data)
+{
+    if (address == flash_cut_at) flash_cut = 1;
+    if (flash_cut || type != FLASH_TYPEPROGRAM_WORD || (address & 3u)) return HAL_ERROR;
+
+    uint32_t *word = Host_FlashPtr(address);
+    *word &= (uint32_t)data;
+    return HAL_OK;
+}
@@ -0,0 +1,280 @@
+/* oem/host/linkTest.c */
+#include "link.h"
+#include "linkTransport.h"
+#include "gameLogic.h"
+#include "aiScheduler.h"
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+//
+// Two-Board Link Checks
+// Two boards play one co-op run over the lockstep link and must end on the
+// same Game_StateHash, with packets dropped or corrupted on the way.
+//   - In process: both boards share this process over a LinkLoopback_t.
+//     Game is one global, so each board's GameState_t/Session is swapped in
+//     around its step (plain data, as for rollback) with the level tables
+//     rebuilt when the boards sit on different levels.
+//   - Socketpair: the same run between two forked simulator processes over
+//     LinkFd, in real time.
+// Bandwidth and added latency come from LinkStats_t.
+//
+#define TEST_TICKS          3000        // One minute of play per case
+#define TEST_MAX_STEPS      2000000     // Logic steps before a case is declared hung
+#define TEST_TAMPER_TICK    510         // Mid-interval: caught at the next checkpoint
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+// ==================== Faulty Cable ====================
+
+// Wraps a transport: every drop_every-th packet vanishes, every corrupt_every-th has a byte flipped
+typedef struct {
+    const LinkTransport_t *inner;
+    uint32_t drop_every;
+    uint32_t corrupt_every;
+    uint32_t packets;
+} Fault_t;
+
+static int Fault_Send(void *ctx, const uint8_t *data, uint16_t len)
+{
+    Fault_t *f = ctx;
+    uint8_t copy[LINK_RX_BUFFER];
+
+    f->packets++;
+    if (f->drop_every && f->packets % f->drop_every == 0) return 1;
+    if (f->corrupt_every && f->packets % f->corrupt_every == 0 && len <= sizeof(copy)) {
+        memcpy(copy, data, len);
+        copy[len / 2] ^= 0x5A;
+        return f->inner->send(f->inner->ctx, copy, len);
+    }
+    return f->inner->send(f->inner->ctx, data, len);
+}
+
+static uint16_t Fault_Recv(void *ctx, uint8_t *data, uint16_t max)
+{
+    Fault_t *f = ctx;
+    return f->inner->recv(f->inner->ctx, data, max);
+}
+
+// ==================== Boards ====================
+
+typedef struct {
+    LinkSession_t link;
+    Fault_t       fault;
+    LinkTransport_t io;
+    GameState_t   game;
+    GameSession_t session;
+    uint8_t       started;
+    uint32_t      lcg;          // Input script
+    uint32_t      tamper_tick;  // Corrupt own state after this tick (0 = never)
+} Board_t;
+
+static void Board_Init(Board_t *b, const LinkTransport_t *cable, uint32_t seed, uint32_t drop, uint32_t corrupt)
+{
+    memset(b, 0, sizeof(*b));
+    b->fault.inner = cable;
+    b->fault.drop_every = drop;
+    b->fault.corrupt_every = corrupt;
+    b->io = (LinkTransport_t){ Fault_Send, Fault_Recv, &b->fault };
+    b->lcg = seed;
+    Link_Start(&b->link, &b->io, MODE_CLASSIC, seed);
+}
+
+// Joystick wander plus fire, different per board
+static void Board_Input(Board_t *b, InputSnapshot_t *in)
+{
+    b->lcg = b->lcg * 1103515245u + 12345u;
+    memset(in, 0, sizeof(*in));
+    in->x = ((int)((b->lcg >> 8) % 201) - 100) / 100.0f;
+    in->y = ((int)((b->lcg >> 4) % 201) - 100) / 100.0f;
+    in->fire_held = (b->lcg >> 20) & 1;
+    in->fire_presses = ((b->lcg >> 24) % 5) == 0;
+    in->entity_cap = 8;
+    in->spawn_interval = 2;
+}
+
+static int Board_Running(void)
+{
+    return Game.state == STATE_PLAYING || Game.state == STATE_LEVEL_TRANSITION;
+}
+
+//
+// One logic step of GameLogic_Step's linked path, on whatever Game holds.
+// Returns 1 while the board still has ticks to run.
+//
+static int Board_Step(Board_t *b)
+{
+    LinkState_t state = Link_Service(&b->link);
+
+    if (!b->started) {
+        if (state == LINK_RUNNING) {
+            Game_InitLinked((GameMode_t)b->link.mode, b->link.seed, b->link.side);
+            Game.state = STATE_PLAYING;
+            AiSched_SetMode(AI_SCHED_QUOTA);
+            b->started = 1;
+        }
+        return 1;
+    }
+
+    if (!Board_Running() || b->link.stats.ticks >= TEST_TICKS) return 0;
+    if (state != LINK_RUNNING) return 0;
+
+    InputSnapshot_t local, p0, p1;
+    Board_Input(b, &local);
+    if (Link_NextTick(&b->link, &local, &p0, &p1)) {
+        Game_TickLinked(&p0, &p1);
+        if (b->tamper_tick && Game.tick == b->tamper_tick) Game.current_score++;
+        Link_EndTick(&b->link);
+    }
+    return 1;
+}
+
+// Swaps a board's simulation into the globals (level tables follow the level)
+static void Board_Enter(Board_t *b)
+{
+    if (b->game.current_level_idx != Game.current_level_idx) {
+        Game_PrepareLevel(b->game.current_level_idx);
+    }
+    memcpy(&Game, &b->game, sizeof(Game));
+    Session = b->session;
+}
+
+static void Board_Leave(Board_t *b)
+{
+    memcpy(&b->game, &Game, sizeof(Game));
+    b->session = Session;
+}
+
+static void Report(const Board_t *b, uint32_t hash)
+{
+    LinkStats_t st;
+    Link_GetStats(&b->link, &st);
+    printf("  side %u: tick %u hash %08x | %u B/tick, +%u ms, %u resent, %u crc, %u stalls, %u checks%s\n",
+           b->link.side, b->game.tick, hash, st.tx_bytes_per_tick, st.added_latency_ms,
+           st.resent_inputs, st.crc_errors, st.stall_polls, st.hash_checks,
+           b->link.state == LINK_DESYNC ? ", DESYNC" : "");
+}
+
+// ==================== In Process ====================
+
+static void Check_Loopback(const char *name, uint32_t drop, uint32_t corrupt, int tamper)
+{
+    static LinkLoopback_t cable;
+    static Board_t boards[2];
+
+    LinkLoopback_Init(&cable);
+    Board_Init(&boards[0], &cable.end[0], 1001, drop, corrupt);
+    Board_Init(&boards[1], &cable.end[1], 2002, drop, corrupt);
+    if (tamper) boards[1].tamper_tick = TEST_TAMPER_TICK;
+
+    // Both start from whatever Game holds now
+    Board_Leave(&boards[0]);
+    Board_Leave(&boards[1]);
+
+    int busy = 1;
+    for (uint32_t step = 0; busy && step < TEST_MAX_STEPS; step++) {
+        busy = 0;
+        for (int n = 0; n < 2; n++) {
+            Board_Enter(&boards[n]);
+            busy |= Board_Step(&boards[n]);
+            Board_Leave(&boards[n]);
+        }
+    }
+
+    uint32_t hash[2];
+    for (int n = 0; n < 2; n++) {
+        Board_Enter(&boards[n]);
+        hash[n] = Game_StateHash();
+    }
+
+    printf("%s (drop every %u, corrupt every %u packets; 0 = never)\n", name, drop, corrupt);
+    for (int n = 0; n < 2; n++) Report(&boards[n], hash[n]);
+
+    CHECK(!busy, "%s: hung", name);
+    CHECK(boards[0].started && boards[1].started, "%s: handshake failed", name);
+    CHECK(boards[0].link.side != boards[1].link.side, "%s: both boards took side %u", name, boards[0].link.side);
+    if (tamper) {
+        CHECK(boards[0].link.state == LINK_DESYNC && boards[1].link.state == LINK_DESYNC,
+              "%s: tampered run not flagged", name);
+        uint32_t checkpoint = (TEST_TAMPER_TICK + LINK_HASH_INTERVAL - 1) / LINK_HASH_INTERVAL * LINK_HASH_INTERVAL;
+        CHECK(boards[0].link.stats.desync_tick == checkpoint,
+              "%s: desync flagged at tick %u", name, boards[0].link.stats.desync_tick);
+    }
+    else {
+        CHECK(boards[0].link.state != LINK_DESYNC && boards[1].link.state != LINK_DESYNC, "%s: desync", name);
+        CHECK(boards[0].game.tick == boards[1].game.tick, "%s: ticks %u != %u", name,
+              boards[0].game.tick, boards[1].game.tick);
+        CHECK(hash[0] == hash[1], "%s: hash %08x != %08x", name, hash[0], hash[1]);
+        CHECK(boards[0].link.stats.hash_checks > 0, "%s: no checkpoint compared", name);
+    }
+}
+
+// ==================== Socketpair ====================
+
+// Runs one board in real time (a logic step per ms) and returns its final hash
+static uint32_t RunProcess(int fd, uint32_t seed)
+{
+    static Board_t board;
+    static int link_fd;
+    static LinkTransport_t io;
+
+    link_fd = fd;
+    LinkFd_Init(&io, &link_fd);
+    Board_Init(&board, &io, seed, 5, 0);
+
+    for (uint32_t step = 0; step < TEST_MAX_STEPS && Board_Step(&board); step++) {
+        usleep(1000);
+    }
+    Board_Leave(&board);
+    Report(&board, Game_StateHash());
+    return board.link.state == LINK_RUNNING ? Game_StateHash() : 0;
+}
+
+static void Check_Socketpair(void)
+{
+    int cable[2], result[2];
+    uint32_t hash[2] = {0, 0};
+
+    signal(SIGPIPE, SIG_IGN);
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, cable) != 0 || pipe(result) != 0) {
+        CHECK(0, "socketpair: setup");
+        return;
+    }
+
+    printf("socketpair (two processes, dropping every 5th packet)\n");
+    fflush(stdout);
+
+    pid_t child = fork();
+    if (child == 0) {
+        close(cable[0]);
+        hash[1] = RunProcess(cable[1], 2002);
+        fflush(stdout);
+        if (write(result[1], &hash[1], sizeof(hash[1])) != sizeof(hash[1])) _exit(1);
+        _exit(0);
+    }
+
+    close(cable[1]);
+    hash[0] = RunProcess(cable[0], 1001);
+    if (read(result[0], &hash[1], sizeof(hash[1])) != sizeof(hash[1])) hash[1] = 0;
+    waitpid(child, NULL, 0);
+
+    CHECK(hash[0] && hash[0] == hash[1], "socketpair: hash %08x != %08x", hash[0], hash[1]);
+}
+
+int main(void)
+{
+    Check_Loopback("clean cable", 0, 0, 0);
+    Check_Loopback("lossy cable", 7, 0, 0);
+    Check_Loopback("noisy cable", 0, 5, 0);
+    Check_Loopback("lossy + noisy", 3, 4, 0);
+    Check_Loopback("tampered state", 0, 0, 1);
+    Check_Socketpair();
+
+    printf(failures ? "linkTest: %d FAILED\n" : "linkTest: ok\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,45 @@
+/* oem/host/pvsGen.c */
+#include "pvs.h"
+#include <stdio.h>
+
+//
+// PVS Table Generator
+// Computes every level's visibility matrix and prints pvsTables.c:
+//   make pvs    regenerate ../src/Engine/pvsTables.c after editing a map
+// simCheck fails while the committed tables and the maps disagree. Links
+// without pvsTables.c, so a stale or missing file never blocks regenerating.
+//
+const PvsTable_t PvsTables[1];
+const int PVS_TABLE_COUNT = 0;
+
+int main(void)
+{
+    static PvsTable_t table;
+
+    printf("/* oem/src/Engine/pvsTables.c */\n");
+    printf("// Generated by oem/host/pvsGen.c from the maps in level.c (make -C oem/host pvs). Do not edit.\n");
+    printf("#include \"pvs.h\"\n\n");
+    printf("const PvsTable_t PvsTables[] = {\n");
+
+    for (int l = 0; l < TOTAL_LEVELS; l++)
+    {
+        Pvs_Compute(AllLevels[l], &table);
+
+        printf("    // Level %d: %u open cells, %lu visible pairs\n", l + 1, table.open_cells,
+               (unsigned long)table.visible_pairs);
+        printf("    { 0x%08lXu, %u, %lu, {\n", (unsigned long)table.source_crc, table.open_cells,
+               (unsigned long)table.visible_pairs);
+        for (int c = 0; c < PVS_CELLS; c++) {
+            printf("        {");
+            for (int w = 0; w < PVS_ROW_WORDS; w++) {
+                printf(" 0x%08lX%s", (unsigned long)table.rows[c][w], w + 1 < PVS_ROW_WORDS ? "," : "");
+            }
+            printf(" },\n");
+        }
+        printf("    } },\n");
+    }
+
+    printf("};\n\n");
+    printf("const int PVS_TABLE_COUNT = %d;\n", TOTAL_LEVELS);
+    return 0;
+}
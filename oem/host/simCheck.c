@@ -0,0 +1,617 @@
+/* oem/host/simCheck.c */
+#include "gameLogic.h"
+#include "replay.h"
+#include "aiScheduler.h"
+#include "renderState.h"
+#include "pvs.h"
+#include "governor.h"
+#include "raycaster.h"
+#include "display.h"
+#include "spawn.h"
+#include "rng.h"
+#include "main.h"
+#include "timing.h"
+#include "snapshot.h"
+#include "rollback.h"
+#include "flashStore.h"
+#include "appConfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+//
+// Single-Board Simulation Checks
+// Runs scripted games through Game_Tick exactly as the logic task does and
+// checks the determinism contracts the firmware leans on: a run repeats
+// bit-exactly from its seed, and a replay of it verifies every hash.
+//
+#define SIM_MAX_TICKS       6000    // 2 minutes: fits the replay buffer
+#define SIM_SEED            1234u
+#define SIM_SPAWN_PER_CELL  400
+#define SIM_GOVERNOR_TICKS  (30 * LOGIC_HZ)
+#define SIM_FRAME_TICKS     3       // ~17 Hz: 33 ms delay + flush + drawing
+#define SIM_RESUME_TICKS    1500    // Snapshot point: 30 s into the run
+#define SIM_ROLLBACK_TICKS  3000
+#define SIM_ROLLBACK_EVERY  5       // Ticks between rewinds, each 1..ROLLBACK_DEPTH ticks back
+#define SIM_ROLLBACK_FIX    1234    // Tick whose input arrives "late" and is corrected
+#define SIM_FLASH_ROTATIONS 3       // Compactions forced by the rotation check
+#define SIM_LEGACY_SCORE    4242u
+#define SIM_BUDGET_CLOCK_SCALE 20000   // DWT speed-up for the budget check (a think "costs" ~1 ms)
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+// Deterministic stand-in for a player: wanders, holds fire a third of the time
+typedef struct {
+    uint32_t lcg;
+    InputSnapshot_t in;
+} Script_t;
+
+static void Script_Reset(Script_t *s)
+{
+    s->lcg = 7;
+    s->in = (InputSnapshot_t){0};
+}
+
+static const InputSnapshot_t *Script_Next(Script_t *s, uint32_t tick)
+{
+    s->lcg = s->lcg * 1103515245u + 12345u;
+    if ((s->lcg >> 16) % 20 == 0) {
+        s->in.x = ((int)((s->lcg >> 8) % 200) - 100) / 100.0f;
+        s->in.y = ((int)((s->lcg >> 4) % 200) - 100) / 100.0f;
+    }
+    s->in.fire_held = ((s->lcg >> 20) % 3) == 0;
+    s->in.fire_presses = ((s->lcg >> 24) % 7) == 0;
+    s->in.entity_cap = 3 + (tick / 500) % 6;
+    s->in.spawn_interval = 1 + (tick / 300) % 4;
+    return &s->in;
+}
+
+static int Running(void)
+{
+    return Game.state == STATE_PLAYING || Game.state == STATE_LEVEL_TRANSITION;
+}
+
+static void StartRun(GameMode_t mode)
+{
+    Game_Init(mode, SIM_SEED);
+    Game.state = STATE_PLAYING;
+    AiSched_SetMode(AI_SCHED_QUOTA);
+}
+
+// Records the script to the end of the run (or the tick cap); returns the final hash.
+// Recording is what quantises the input, as on the board.
+static uint32_t PlayScript(GameMode_t mode)
+{
+    Script_t script;
+    Script_Reset(&script);
+    StartRun(mode);
+    Replay_StartRecording(mode, SIM_SEED);
+
+    for (uint32_t t = 0; t < SIM_MAX_TICKS && Running(); t++) {
+        InputSnapshot_t input = *Script_Next(&script, t);
+        Replay_BeginTick(&input);
+        Game_Tick(&input);
+        Replay_EndTick();
+    }
+
+    Replay_StopRecording();
+    return Game_StateHash();
+}
+
+static void Check_Determinism(GameMode_t mode)
+{
+    uint32_t first = PlayScript(mode);
+    uint32_t rerun = PlayScript(mode);
+    uint32_t ticks = Game.tick;
+
+    CHECK(rerun == first, "mode %d: rerun hash %08x != %08x", mode, rerun, first);
+
+    // Playback ignores the live input and must land on the recorded hash
+    GameMode_t rec_mode;
+    uint32_t seed;
+    CHECK(Replay_StartPlayback(&rec_mode, &seed), "mode %d: no recording", mode);
+    StartRun(rec_mode);
+    InputSnapshot_t idle = {0};
+    while (Running() && Replay_BeginTick(&idle)) {
+        Game_Tick(&idle);
+        Replay_EndTick();
+    }
+    ReplayStatus_t st;
+    Replay_GetStatus(&st);
+    Replay_StopPlayback();
+
+    CHECK(st.verified && st.first_mismatch == 0, "mode %d: replay mismatch at tick %u", mode, st.first_mismatch);
+    CHECK(Game_StateHash() == rerun, "mode %d: replay hash %08x != %08x", mode, Game_StateHash(), rerun);
+
+    printf("mode %d: %u ticks, state %d, score %u, hash %08x, replay %u bytes verified\n",
+           mode, ticks, Game.state, Game.current_score, first, st.bytes_used);
+}
+
+//
+// A run recorded with the AI in budget mode replays exactly. The host is far
+// faster than the board, so the DWT clock is sped up until the budget cuts
+// the round robin short on most ticks, at points that vary with real time.
+//
+static void Check_BudgetReplay(GameMode_t mode)
+{
+    Script_t script;
+    Script_Reset(&script);
+    StartRun(mode);
+    AiSched_SetMode(AI_SCHED_BUDGET);
+    AiSched_ResetStats();
+    Host_SetClockScale(SIM_BUDGET_CLOCK_SCALE);
+    Replay_StartRecording(mode, SIM_SEED);
+
+    // Every stop costs stream bytes, so the buffer may fill first: end there
+    for (uint32_t t = 0; t < SIM_MAX_TICKS && Running(); t++) {
+        InputSnapshot_t input = *Script_Next(&script, t);
+        Replay_BeginTick(&input);
+        if (Replay_GetMode() != REPLAY_RECORDING) break;
+        Game_Tick(&input);
+        Replay_EndTick();
+    }
+    Replay_StopRecording();
+    Host_SetClockScale(1);
+
+    uint32_t recorded = Game_StateHash();
+    AiSchedStats_t sched;
+    AiSched_GetStats(&sched);
+
+    GameMode_t rec_mode;
+    uint32_t seed;
+    CHECK(Replay_StartPlayback(&rec_mode, &seed), "budget mode %d: no recording", mode);
+    StartRun(rec_mode);
+    InputSnapshot_t idle = {0};
+    while (Running() && Replay_BeginTick(&idle)) {
+        Game_Tick(&idle);
+        Replay_EndTick();
+    }
+    ReplayStatus_t st;
+    Replay_GetStatus(&st);
+    Replay_StopPlayback();
+
+    printf("budget mode %d: %u ticks, %u budget stops, replay %u bytes, hash %08x\n",
+           mode, st.ticks, sched.budget_stops, st.bytes_used, recorded);
+    CHECK(sched.budget_stops > 0, "budget mode %d: budget never stopped the AI", mode);
+    CHECK(st.verified && st.first_mismatch == 0, "budget mode %d: replay mismatch at tick %u", mode, st.first_mismatch);
+    CHECK(Game_StateHash() == recorded, "budget mode %d: replay hash %08x != %08x", mode, Game_StateHash(), recorded);
+}
+
+//
+// Render interpolation in real time: logic publishes every LOGIC_TICK_MS while
+// frames sample at the render task's ~30 Hz, so the two drift past each other
+// and (scheduler jitter aside) every frame lands between two published ticks.
+//
+static void Check_Interpolation(void)
+{
+    Script_t script;
+    Script_Reset(&script);
+    StartRun(MODE_CLASSIC);
+    RenderState_Reset();
+
+    Camera_t cam;
+    SpritePos_t sprites[RENDER_MAX_SPRITES], shots[PROJECTILE_CAPACITY], ally;
+    uint32_t now_ms = 0, next_frame_ms = 2 * LOGIC_TICK_MS;   // Two ticks of history first
+
+    for (uint32_t t = 0; t < 2 * LOGIC_HZ && Running(); t++) {
+        Game_Tick(Script_Next(&script, t));
+        RenderState_Publish();
+        for (int ms = 0; ms < LOGIC_TICK_MS; ms++, now_ms++) {
+            if (now_ms >= next_frame_ms) {
+                RenderState_Interpolate(Timing_Now(), &cam, sprites, shots, &ally);
+                next_frame_ms += 33;
+            }
+            usleep(1000);
+        }
+    }
+
+    RenderStateStats_t st;
+    RenderState_GetStats(&st);
+    printf("interpolation: %u blended, %u held, %u clamped\n", st.blended, st.held, st.clamped);
+    CHECK(st.blended > 0 && st.blended > 2 * (st.held + st.clamped), "interpolation: frames not blended");
+}
+
+//
+// The governor raises the arcade population when drawing has headroom. A
+// frame is drawn every SIM_FRAME_TICKS ticks and reported as the render task
+// does; 'flush_us' adds a fixed panel flush to each report (the old
+// draw + flush measurement, which never looked calm).
+//
+static void Check_GovernorCase(uint32_t flush_us, uint32_t *raises, uint8_t *cap)
+{
+    Script_t script;
+    Script_Reset(&script);
+    StartRun(MODE_ARCADE);
+    Governor_Reset();
+    RenderState_Reset();
+
+    Camera_t cam;
+    SpritePos_t sprites[RENDER_MAX_SPRITES], shots[PROJECTILE_CAPACITY], ally;
+    GovernorStats_t before, st;
+    Governor_GetStats(&before);
+
+    for (uint32_t t = 0; t < SIM_GOVERNOR_TICKS && Running(); t++) {
+        InputSnapshot_t input = *Script_Next(&script, t);
+        input.entity_cap = Governor_EntityCap();
+        input.spawn_interval = Governor_SpawnInterval();
+        Game.player.health = 100;   // Keep the run going
+
+        uint32_t tick_start = Timing_Now();
+        Game_Tick(&input);
+        Governor_ReportLogic(Timing_Now() - tick_start);
+        Governor_Update();
+        RenderState_Publish();
+
+        if (t % SIM_FRAME_TICKS == 0) {
+            uint32_t draw_start = Timing_Now();
+            RenderState_Interpolate(draw_start, &cam, sprites, shots, &ally);
+            ClearScreen();
+            Render_3D_View(&cam);
+            Render_Enemies(&cam, sprites, RENDER_MAX_SPRITES);
+            Render_Projectiles(&cam, shots, PROJECTILE_CAPACITY);
+            Governor_ReportRender(Timing_Now() - draw_start + Timing_UsToCycles(flush_us));
+        }
+    }
+
+    Governor_GetStats(&st);
+    *raises = st.raises - before.raises;
+    *cap = st.entity_cap;
+    printf("governor (+%u us flush): render avg %u us, logic avg %u us, %u raises, %u lowers, cap %u\n",
+           flush_us, st.render_avg_us, st.logic_avg_us, *raises, st.lowers - before.lowers, st.entity_cap);
+}
+
+static void Check_Governor(void)
+{
+    uint32_t raises;
+    uint8_t cap;
+
+    Check_GovernorCase(0, &raises, &cap);
+    CHECK(raises > 0 && cap > GOV_MIN_ENEMIES, "governor: never raised (cap %u)", cap);
+
+    // What the render task used to report: the I2C flush alone is past the calm threshold
+    Check_GovernorCase(25000, &raises, &cap);
+    CHECK(raises == 0, "governor: raised with a 25 ms flush counted");
+}
+
+//
+// Every valid spawn cell is equally likely, on an open level (rejection
+// draws) and in a room crowded until most draws miss (candidate list).
+// Each cell gets SIM_SPAWN_PER_CELL picks on average; all must stay within
+// +-35% of that (> 5 sigma at 400).
+//
+static void Check_SpawnCase(const char *name, const Level_t *level, const SpatialIndex_t *grid, int px, int py)
+{
+    static uint32_t hits[MAP_W * MAP_H];
+    uint32_t rng = Rng_Seed(SIM_SEED);
+    int cx, cy, valid = 0;
+
+    memset(hits, 0, sizeof(hits));
+    for (int x = 0; x < MAP_W; x++) {
+        for (int y = 0; y < MAP_H; y++) {
+            if (level->map[x][y] != 0 || grid->head[x * MAP_H + y] != SPATIAL_NONE) continue;
+            if (abs(x - px) < SPAWN_MIN_PLAYER_CELLS && abs(y - py) < SPAWN_MIN_PLAYER_CELLS) continue;
+            valid++;
+        }
+    }
+
+    SpawnStats_t before, after;
+    Spawn_GetStats(&before);
+    for (int n = 0; n < valid * SIM_SPAWN_PER_CELL; n++) {
+        if (Spawn_PickCell(&rng, grid, px, py, &cx, &cy)) hits[cx * MAP_H + cy]++;
+    }
+    Spawn_GetStats(&after);
+
+    uint32_t lo = 0xFFFFFFFFu, hi = 0, picked = 0;
+    for (int c = 0; c < MAP_W * MAP_H; c++) {
+        if (!hits[c]) continue;
+        picked++;
+        if (hits[c] < lo) lo = hits[c];
+        if (hits[c] > hi) hi = hits[c];
+    }
+    printf("spawn %s: %d valid cells, hits %u..%u per cell, %u rejected draws, %u full scans\n", name, valid, lo, hi,
+           after.rejected_draws - before.rejected_draws, after.full_scans - before.full_scans);
+    CHECK(picked == (uint32_t)valid, "spawn %s: %u of %d valid cells picked", name, picked, valid);
+    CHECK(lo * 100 >= SIM_SPAWN_PER_CELL * 65 && hi * 100 <= SIM_SPAWN_PER_CELL * 135,
+          "spawn %s: biased (%u..%u per cell)", name, lo, hi);
+}
+
+static void Check_SpawnUniform(void)
+{
+    static SpatialIndex_t grid;
+    static Level_t room;
+
+    Game_PrepareLevel(0);
+    Spatial_Clear(&grid);
+    Check_SpawnCase("open", Game_Level(), &grid, 8, 8);
+
+    // A 5 x 8 room with all but 8 cells occupied: most draws miss
+    memset(&room, 1, sizeof(room.map));
+    for (int x = 1; x <= 5; x++) {
+        for (int y = 1; y <= 8; y++) room.map[x][y] = 0;
+    }
+    Spawn_LoadLevel(&room);
+    for (int idx = 0; idx < 32 && idx < ENTITY_CAPACITY; idx++) {
+        Spatial_Insert(&grid, idx, 1 + idx / 8 + 0.5f, 1 + idx % 8 + 0.5f);
+    }
+    Check_SpawnCase("crowded", &room, &grid, 14, 14);
+}
+
+// ==================== Flash Store ====================
+
+// What each key should read back as (len 0 = never written)
+static uint8_t  flash_expect[FS_KEY_COUNT][FLASH_STORE_MAX_PAYLOAD];
+static uint16_t flash_expect_len[FS_KEY_COUNT];
+static uint32_t flash_writes;
+
+static void Flash_Reboot(void)
+{
+    Host_FlashCutAt(0);
+    FlashStore_Init();
+}
+
+static FlashStoreStats_t Flash_Stats(void)
+{
+    FlashStoreStats_t st;
+    FlashStore_GetStats(&st);
+    return st;
+}
+
+static uint32_t Flash_NextRecord(void)
+{
+    FlashStoreStats_t st = Flash_Stats();
+    return st.active_sector + FLASH_STORE_SECTOR_SIZE - st.bytes_free;
+}
+
+// Writes a fresh value and flushes it; 'lands' = 0 when a power cut will eat it
+static void Flash_Put(FlashStoreKey_t key, uint16_t len, int lands)
+{
+    static uint8_t value[FLASH_STORE_MAX_PAYLOAD];
+
+    flash_writes++;
+    for (uint16_t i = 0; i < len; i++) value[i] = (uint8_t)(flash_writes * 7u + key * 31u + i);
+    FlashStore_Write(key, value, len);
+    FlashStore_Flush();
+
+    if (lands) {
+        memcpy(flash_expect[key], value, len);
+        flash_expect_len[key] = len;
+    }
+}
+
+static void Flash_Expect(const char *name)
+{
+    static uint8_t value[FLASH_STORE_MAX_PAYLOAD];
+
+    for (int key = 0; key < FS_KEY_COUNT; key++) {
+        if (!flash_expect_len[key]) continue;
+        uint16_t len = sizeof(value);
+        FlashStoreStatus_t status = FlashStore_Read((FlashStoreKey_t)key, value, &len);
+        CHECK(status == FS_OK && len == flash_expect_len[key] && memcmp(value, flash_expect[key], len) == 0,
+              "flash %s: key %d reads back status %d, %u bytes, not the newest value", name, key, status, len);
+    }
+}
+
+static uint32_t Flash_Other(uint32_t base)
+{
+    return base == FLASH_STORE_SECTOR_A ? FLASH_STORE_SECTOR_B : FLASH_STORE_SECTOR_A;
+}
+
+//
+// The real flashStore.c over host memory (hostPlatform.c). Every case ends by
+// rebooting, i.e. re-scanning the log, and reading back the newest value of
+// every key.
+//
+static void Check_FlashStore(void)
+{
+    FlashStoreStats_t st;
+    uint16_t big = FLASH_STORE_MAX_PAYLOAD;
+
+    Host_FlashWipe();
+    memset(flash_expect_len, 0, sizeof(flash_expect_len));
+    Flash_Reboot();
+
+    // Repeated writes rotate the log between the sectors
+    for (uint32_t n = 0; Flash_Stats().compactions < SIM_FLASH_ROTATIONS && n < 100000; n++) {
+        FlashStoreKey_t key = (FlashStoreKey_t)(n % FS_KEY_COUNT);
+        Flash_Put(key, key == FS_KEY_SNAPSHOT ? big - (n % 5) * 4 : 4 + key * 16, 1);
+    }
+    st = Flash_Stats();
+    uint32_t generation = st.generation;
+    Flash_Expect("rotation (live)");
+    Flash_Reboot();
+    Flash_Expect("rotation");
+    CHECK(Flash_Stats().generation == generation && st.write_errors == 0,
+          "flash rotation: generation %u after reboot, %u before, %u write errors",
+          Flash_Stats().generation, generation, st.write_errors);
+    printf("flash rotation: %u writes, %u compactions, generation %u\n", flash_writes, st.compactions, generation);
+
+    // Power cut mid-record: the torn record is skipped, the log carries on past it
+    Host_FlashCutAt(Flash_NextRecord() + sizeof(FlashRecordHeader_t) + 8);
+    Flash_Put(FS_KEY_SNAPSHOT, big, 0);
+    CHECK(Flash_Stats().write_errors == 1, "flash truncated: write not failed");
+    Flash_Reboot();
+    Flash_Expect("truncated");
+    CHECK(Flash_Stats().records_corrupt == 1, "flash truncated: %u corrupt records", Flash_Stats().records_corrupt);
+    Flash_Put(FS_KEY_APP_CONFIG, 20, 1);
+    Flash_Reboot();
+    Flash_Expect("truncated (appended after)");
+
+    // Fill the sector until the next big record must compact
+    while (Flash_Stats().bytes_free >= sizeof(FlashRecordHeader_t) + big) {
+        Flash_Put(FS_KEY_SNAPSHOT, big, 1);
+    }
+    st = Flash_Stats();
+
+    // Power cut after the copy, before the new sector's magic: the old one stays active
+    Host_FlashCutAt(Flash_Other(st.active_sector));
+    Flash_Put(FS_KEY_SNAPSHOT, big, 0);
+    Flash_Reboot();
+    Flash_Expect("cut before magic");
+    CHECK(Flash_Stats().active_sector == st.active_sector && Flash_Stats().generation == st.generation,
+          "flash cut before magic: booted 0x%08x gen %u, expected 0x%08x gen %u",
+          Flash_Stats().active_sector, Flash_Stats().generation, st.active_sector, st.generation);
+
+    // Completed copy: both sectors carry the magic, the newer generation wins
+    Flash_Put(FS_KEY_SNAPSHOT, big, 1);
+    Flash_Reboot();
+    Flash_Expect("both sectors valid");
+    CHECK(Flash_Stats().active_sector == Flash_Other(st.active_sector) && Flash_Stats().generation == st.generation + 1,
+          "flash both valid: booted 0x%08x gen %u", Flash_Stats().active_sector, Flash_Stats().generation);
+
+    // First boot after the raw-word firmware: the old score becomes a record
+    Host_FlashWipe();
+    uint32_t legacy = SIM_LEGACY_SCORE;
+    HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, FLASH_STORE_SECTOR_B, legacy);
+    Flash_Reboot();
+    CHECK(LoadHighScore() == SIM_LEGACY_SCORE, "flash legacy: high score %u", LoadHighScore());
+    Flash_Reboot();
+    CHECK(LoadHighScore() == SIM_LEGACY_SCORE && Flash_Stats().active_sector == FLASH_STORE_SECTOR_A,
+          "flash legacy: high score %u after a second boot", LoadHighScore());
+
+    // Clean store for the checks that follow
+    Host_FlashWipe();
+    Flash_Reboot();
+}
+
+//
+// A run saved mid-play resumes to the same hash from the RAM image and, after
+// a power cycle, from the flash copy. Both paths only rebuild level tables.
+//
+static void Check_ResumeCase(GameMode_t mode, uint8_t expect_from)
+{
+    Script_t script;
+    Script_Reset(&script);
+    StartRun(mode);
+    for (uint32_t t = 0; t < SIM_RESUME_TICKS && Running(); t++) {
+        Game_Tick(Script_Next(&script, t));
+    }
+
+    Snapshot_SaveRam();
+    uint32_t saved = Game_StateHash();
+    if (expect_from == 2) {
+        // Through the real record format: programmed, then found by the boot scan
+        Snapshot_MirrorToFlash();
+        FlashStore_Flush();
+        Snapshot_PowerCycle();
+        FlashStore_Init();
+    }
+
+    // Boot into something else first, as the board would
+    Game_Init(mode == MODE_CLASSIC ? MODE_ARCADE : MODE_CLASSIC, SIM_SEED + 1);
+    int resumed = Snapshot_Resume();
+
+    SnapshotStats_t st;
+    Snapshot_GetStats(&st);
+    printf("resume mode %d from %s: level %u, tick %u, %u bytes, %u us\n", mode,
+           expect_from == 1 ? "RAM" : "flash", Game.current_level_idx + 1, Game.tick, st.bytes, st.resume_us);
+
+    CHECK(resumed && st.resumed_from == expect_from, "resume mode %d: from %u, expected %u", mode, st.resumed_from, expect_from);
+    CHECK(Game_StateHash() == saved, "resume mode %d: hash %08x != %08x", mode, Game_StateHash(), saved);
+}
+
+static void Check_Resume(void)
+{
+    Check_ResumeCase(MODE_CLASSIC, 1);
+    Check_ResumeCase(MODE_CLASSIC, 2);
+    Check_ResumeCase(MODE_ARCADE, 1);
+    Check_ResumeCase(MODE_ARCADE, 2);
+    Snapshot_Invalidate();
+}
+
+//
+// Plays the script with one input replaced (fix NULL = as scripted). With
+// rewind, every few ticks go back and re-run, and the replacement arrives
+// late through Rollback_SetInput. Rewinding must not change the outcome.
+//
+static uint32_t PlayRollback(GameMode_t mode, int rewind, const InputSnapshot_t *fix)
+{
+    Script_t script;
+    Script_Reset(&script);
+    StartRun(mode);
+    Rollback_Reset();
+
+    for (uint32_t t = 0; t < SIM_ROLLBACK_TICKS && Running(); t++) {
+        InputSnapshot_t input = *Script_Next(&script, t);
+        if (!rewind && fix && t == SIM_ROLLBACK_FIX) input = *fix;
+
+        Rollback_SaveTick(&input);
+        Game_Tick(&input);
+
+        if (!rewind) continue;
+        if (fix && Game.tick == SIM_ROLLBACK_FIX + 3) {
+            CHECK(Rollback_SetInput(SIM_ROLLBACK_FIX, fix), "rollback: tick %u not held", SIM_ROLLBACK_FIX);
+            CHECK(Rollback_Resimulate(SIM_ROLLBACK_FIX), "rollback: resimulate from the fix");
+        }
+        else if (t % SIM_ROLLBACK_EVERY == 0 && t >= ROLLBACK_DEPTH) {
+            uint32_t back = 1 + (t / SIM_ROLLBACK_EVERY) % ROLLBACK_DEPTH;
+            CHECK(Rollback_Resimulate(Game.tick - back), "rollback: %u ticks back at %u", back, Game.tick);
+        }
+    }
+    return Game_StateHash();
+}
+
+static void Check_Rollback(GameMode_t mode)
+{
+    InputSnapshot_t fix = { .x = -1.0f, .fire_held = 1, .fire_presses = 1, .entity_cap = 8, .spawn_interval = 1 };
+
+    uint32_t scripted = PlayRollback(mode, 0, NULL);
+    uint32_t straight = PlayRollback(mode, 0, &fix);
+    uint32_t ticks = Game.tick;
+
+    RollbackStats_t before, st;
+    Rollback_GetStats(&before);
+    uint32_t rewound = PlayRollback(mode, 1, &fix);
+    Rollback_GetStats(&st);
+
+    printf("rollback mode %d: %u ticks, %u B/tick, %u restores, save %u cycles, resim %u cycles/tick, hash %08x\n",
+           mode, ticks, st.bytes_per_tick, st.restores - before.restores, st.save_cycles, st.resim_tick_cycles, rewound);
+
+    CHECK(straight != scripted, "rollback mode %d: the corrected input changes nothing", mode);
+    CHECK(Game.tick == ticks, "rollback mode %d: ended on tick %u, not %u", mode, Game.tick, ticks);
+    CHECK(rewound == straight, "rollback mode %d: hash %08x != %08x", mode, rewound, straight);
+}
+
+//
+// The committed PVS tables must be what the maps produce today (make pvs)
+//
+static void Check_PvsTables(void)
+{
+    static PvsTable_t computed;
+
+    CHECK(PVS_TABLE_COUNT == TOTAL_LEVELS, "pvs: %d tables for %d levels", PVS_TABLE_COUNT, TOTAL_LEVELS);
+    for (int l = 0; l < TOTAL_LEVELS && l < PVS_TABLE_COUNT; l++) {
+        uint32_t t0 = Timing_Now();
+        Pvs_Compute(AllLevels[l], &computed);
+        uint32_t compute_us = Timing_CyclesToUs(Timing_Now() - t0);
+
+        Game_PrepareLevel(l);
+        PvsStats_t st;
+        Pvs_GetStats(&st);
+        printf("pvs level %d: %u pairs, load %u us (full build %u us)\n", l + 1, st.visible_pairs, st.load_us, compute_us);
+
+        CHECK(memcmp(&computed, &PvsTables[l], sizeof(computed)) == 0, "pvs level %d: table out of date (make pvs)", l + 1);
+        CHECK(!st.stale, "pvs level %d: loaded with culling off", l + 1);
+    }
+}
+
+int main(void)
+{
+    Check_FlashStore();
+    Check_PvsTables();
+    Check_SpawnUniform();
+    Check_Determinism(MODE_CLASSIC);
+    Check_Determinism(MODE_ARCADE);
+    Check_BudgetReplay(MODE_CLASSIC);
+    Check_BudgetReplay(MODE_ARCADE);
+    Check_Resume();
+    Check_Rollback(MODE_CLASSIC);
+    Check_Rollback(MODE_ARCADE);
+    Check_Interpolation();
+    Check_Governor();
+
+    printf(failures ? "simCheck: %d FAILED\n" : "simCheck: ok\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,16 @@
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stdint.h>
+
+// Host stand-in: single threaded, so critical sections are empty
+typedef long BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+#define taskENTER_CRITICAL()    do {} while (0)
+#define taskEXIT_CRITICAL()     do {} while (0)
+
+#endif /* INC_FREERTOS_H */
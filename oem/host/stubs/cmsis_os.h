@@ -0,0 +1,7 @@
+#ifndef CMSIS_OS_H_
+#define CMSIS_OS_H_
+
+// Host stand-in: the project only uses the v2 API
+#include "cmsis_os2.h"
+
+#endif /* CMSIS_OS_H_ */
@@ -0,0 +1,30 @@
+#ifndef CMSIS_OS2_H_
+#define CMSIS_OS2_H_
+
+#include <stdint.h>
+
+//
+// Host stand-in for CMSIS-RTOS v2: the host programs are single threaded and
+// never start a kernel, so mutexes are no-ops and thread flags go nowhere.
+//
+typedef void *osThreadId_t;
+typedef void *osMutexId_t;
+typedef void (*osThreadFunc_t)(void *argument);
+
+typedef enum {
+    osPriorityIdle = 1, osPriorityLow = 8, osPriorityBelowNormal = 16,
+    osPriorityNormal = 24, osPriorityAboveNormal = 32, osPriorityHigh = 40
+} osPriority_t;
+typedef enum { osOK = 0, osError = -1, osErrorTimeout = -2 } osStatus_t;
+typedef enum { osKernelInactive, osKernelReady, osKernelRunning } osKernelState_t;
+
+#define osWaitForever   0xFFFFFFFFu
+
+osKernelState_t osKernelGetState(void);
+osMutexId_t osMutexNew(const void *attr);
+osStatus_t osMutexAcquire(osMutexId_t mutex, uint32_t timeout);
+osStatus_t osMutexRelease(osMutexId_t mutex);
+osThreadId_t osThreadGetId(void);
+uint32_t osThreadFlagsSet(osThreadId_t thread, uint32_t flags);
+
+#endif /* CMSIS_OS2_H_ */
@@ -0,0 +1,12 @@
+#ifndef __MAIN_H
+#define __MAIN_H
+
+// Host stand-in for Core/Inc/main.h
+#include "stm32f4xx_hal.h"
+
+void Error_Handler(void);
+
+#define B1_Pin          GPIO_PIN_13
+#define B1_GPIO_Port    GPIOC
+
+#endif /* __MAIN_H */
@@ -0,0 +1,8 @@
+#ifndef SEMAPHORE_H
+#define SEMAPHORE_H
+
+#include "FreeRTOS.h"
+
+typedef void *SemaphoreHandle_t;
+
+#endif /* SEMAPHORE_H */
@@ -0,0 +1,79 @@
+#ifndef __STM32F4xx_HAL_H
+#define __STM32F4xx_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//
+// Host Stand-In for the STM32F4 HAL
+// Only what the engine headers and the host-compiled sources touch. The DWT
+// cycle counter reads the host's monotonic clock scaled to SystemCoreClock,
+// so Timing_* and every cycle figure keep their on-target meaning (84 MHz
+// ticks), measured on the host CPU.
+//
+#define __IO volatile
+#define __weak __attribute__((weak))
+
+typedef enum { HAL_OK, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+
+// --- Core ---
+typedef struct { volatile uint32_t CTRL; volatile uint32_t CYCCNT; } DWT_Type;
+typedef struct { volatile uint32_t DEMCR; } CoreDebug_Type;
+DWT_Type *Host_Dwt(void);                   // Refreshes CYCCNT from the host clock
+void Host_SetClockScale(uint32_t scale);    // DWT runs this many times faster than real time (tests)
+extern CoreDebug_Type Host_CoreDebug;
+extern uint32_t SystemCoreClock;
+#define DWT                         (Host_Dwt())
+#define CoreDebug                   (&Host_CoreDebug)
+#define DWT_CTRL_CYCCNTENA_Msk      1u
+#define CoreDebug_DEMCR_TRCENA_Msk  (1u << 24)
+
+#define __DMB()                     __sync_synchronize()
+#define __DSB()                     __sync_synchronize()
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+#define SET_BIT(reg, bit)           ((reg) |= (bit))
+#define CLEAR_BIT(reg, bit)         ((reg) &= ~(bit))
+
+// --- GPIO ---
+typedef enum { GPIO_PIN_RESET, GPIO_PIN_SET } GPIO_PinState;
+typedef struct { uint32_t IDR, ODR; } GPIO_TypeDef;
+extern GPIO_TypeDef Host_GpioA, Host_GpioC;
+#define GPIOA                       (&Host_GpioA)
+#define GPIOC                       (&Host_GpioC)
+#define GPIO_PIN_10                 0x0400u
+#define GPIO_PIN_13                 0x2000u
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin);
+
+// --- UART (USART2 export path) ---
+typedef struct { volatile uint32_t SR, DR, BRR, CR1, CR2, CR3, GTPR; } USART_TypeDef;
+typedef struct { USART_TypeDef *Instance; } UART_HandleTypeDef;
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size, uint32_t timeout);
+
+// --- Flash (sectors 6 and 7 only, backed by host memory) ---
+// Programming only clears bits, as on the chip. A simulated power cut makes
+// every program and erase from a chosen address on fail until it is lifted.
+typedef struct {
+    uint32_t TypeErase;
+    uint32_t Banks;
+    uint32_t Sector;
+    uint32_t NbSectors;
+    uint32_t VoltageRange;
+} FLASH_EraseInitTypeDef;
+#define FLASH_TYPEERASE_SECTORS     0u
+#define FLASH_VOLTAGE_RANGE_3       2u
+#define FLASH_SECTOR_6              6u
+#define FLASH_SECTOR_7              7u
+#define FLASH_TYPEPROGRAM_WORD      2u
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *erase, uint32_t *sector_error);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t type, uint32_t address, uint64_t data);
+void *Host_FlashPtr(uint32_t address);      // Host memory behind a sector 6/7 address
+void Host_FlashWipe(void);                  // Both sectors erased, as on a new board
+void Host_FlashCutAt(uint32_t address);     // Power cut when this word is programmed (0 = none)
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t ms);
+
+#endif /* __STM32F4xx_HAL_H */
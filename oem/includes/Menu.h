@@ -2,10 +2,12 @@
 #ifndef INCLUDES_MENU_H_
 #define INCLUDES_MENU_H_
 
+#include "gameLogic.h"
 #include <stdint.h>
 
 void UI_DrawString(int x, int y, const char* str);
 void UI_DrawRect(int x, int y, int w, int h);
 void UI_DrawTitle(int x, int y); // The Doom Logo
+void UI_DrawMenu(MenuOption_t selected, uint8_t linking); // linking = co-op handshake in progress
 
 #endif /* INCLUDES_MENU_H_ */
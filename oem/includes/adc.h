@@ -10,10 +10,23 @@
 #define JOY_PORT_BUTTON          GPIOA
 #define JOY_PIN_BUTTON           GPIO_PIN_10
 
+// --- Acquisition Timing ---
+// TIM3 TRGO starts one X/Y scan per period; DMA fills a circular buffer
+// split in two halves and notifies the owning thread as each half completes.
+#define ADC_CHANNELS             2       // X (Rank 1), Y (Rank 2)
+#define ADC_SCAN_RATE_HZ         1000    // Scans per second (TIM3 update rate)
+#define ADC_SCANS_PER_HALF       10      // Oversampling factor -> one block every 10 ms
+#define ADC_BUFFER_LEN           (2 * ADC_SCANS_PER_HALF * ADC_CHANNELS)
+
+// --- Thread Flags raised from the DMA callbacks ---
+#define ADC_FLAG_HALF            0x0001U // First half of the buffer is ready
+#define ADC_FLAG_FULL            0x0002U // Second half of the buffer is ready
+
 // --- Function Prototypes ---
-void ADC_Joystick_Init(void);
+void ADC_Joystick_Init(void);   // Call from the thread that should receive ADC_FLAG_*
 
-// New "Zero-Cost" Accessors (Read directly from RAM)
+// Averaged accessors (mean of the most recently completed half-buffer)
+void     ADC_ReadAveraged(uint16_t *x, uint16_t *y);
 uint32_t ADC_GetX(void);
 uint32_t ADC_GetY(void);
 uint8_t  ADC_ReadButton(void);
@@ -0,0 +1,56 @@
+#ifndef __AISCHEDULER_H
+#define __AISCHEDULER_H
+
+#include "entity.h"
+#include <stdint.h>
+
+//
+// Time-Sliced AI Scheduler
+// Instead of thinking for every enemy in one burst every AI_TICK_INTERVAL
+// ticks, each logic tick thinks for a round-robin slice of the entities:
+//   1. Any entity whose last think is AI_MAX_THINK_AGE ticks old is thought
+//      first, whatever the quota or budget (minimum think-rate guarantee).
+//      These are reported as starved: the round robin failed to reach them.
+//   2. The round robin continues from where the last tick stopped until the
+//      quota (live count / AI_TICK_INTERVAL) is met or, in budget mode, the
+//      DWT cycle budget for this tick is spent.
+// Budget mode depends on measured time. Quota mode makes the exact same
+// choices on every run, so lockstep uses it. A recording may run in budget
+// mode: it stores where each budget stop fell (AiSched_TakeBudgetStop) and
+// playback, in quota mode, stops the round robin at the same think
+// (AiSched_LimitNextRun).
+//
+#define AI_MIN_THINK_HZ     5                               // Guaranteed per-entity think rate
+#define AI_MAX_THINK_AGE    (LOGIC_HZ / AI_MIN_THINK_HZ)    // Ticks before a think is forced
+#ifndef AI_BUDGET_US
+#define AI_BUDGET_US        1500                            // Round-robin budget per tick (budget mode)
+#endif
+#define AI_SCHED_NO_STOP    0xFF                            // No budget stop in the run
+
+typedef enum {
+    AI_SCHED_QUOTA,     // Deterministic: fixed thinks per tick
+    AI_SCHED_BUDGET     // Quota, further capped by AI_BUDGET_US of measured time
+} AiSchedMode_t;
+
+typedef struct {
+    uint32_t ticks;             // Scheduler runs
+    uint32_t thinks;            // Entity thinks executed
+    uint32_t starved;           // Thinks that had to be forced by the age guarantee
+    uint32_t budget_stops;      // Ticks where the budget ended the round robin early
+    uint32_t last_cycles;       // Cycles spent in the last run
+    uint32_t max_cycles;        // Worst run since the last reset
+} AiSchedStats_t;
+
+// Called for one entity; 'age' = ticks since its previous think (>= 1)
+typedef void (*AiThinkFn_t)(int idx, uint32_t age);
+
+// Function Prototypes
+void AiSched_Run(EntityStore_t *ents, uint8_t *cursor, uint32_t now_tick, AiThinkFn_t think);
+void AiSched_SetMode(AiSchedMode_t mode);
+AiSchedMode_t AiSched_GetMode(void);
+uint8_t AiSched_TakeBudgetStop(void);     // Round-robin thinks before the budget ended the last run (read once)
+void AiSched_LimitNextRun(uint8_t thinks); // Replays that stop: next run ends its round robin there
+void AiSched_GetStats(AiSchedStats_t *stats);
+void AiSched_ResetStats(void);
+
+#endif /* __AISCHEDULER_H */
@@ -18,6 +18,16 @@
 #define DEBUG_GOD_MODE      1
 #define DEBUG_SHOW_COORDS   1
 
+// Boot-time DWT benchmarks (results in benchmark.h and on USART2, adds ~1 s to startup)
+#ifndef ENABLE_BENCHMARKS
+#define ENABLE_BENCHMARKS   0
+#endif
+
+// Rollback save points before every tick (rollback.h: ~21 KB of RAM, a 2.7 KB copy per tick)
+#ifndef ENABLE_ROLLBACK
+#define ENABLE_ROLLBACK     0
+#endif
+
 // Global Configuration State
 typedef struct appConfig
 {
@@ -27,8 +37,20 @@ typedef struct appConfig
 	uint8_t invert_y_axis;  // 1 = Inverted, 0 = Normal
 	float   sensitivity;    // Joystick sensitivity (e.g., 0.5 to 1.5)
 	uint8_t difficulty;     // 0 = Easy (Enemies have less HP), 1 = Hard
+
+	// Joystick calibration (raw 12-bit ADC counts); each side of the centre
+	// scales to its own travel, so an off-centre rest point still reaches +-1.0
+	uint16_t joy_center_x;  // Resting X reading
+	uint16_t joy_center_y;  // Resting Y reading
+	uint16_t joy_min_x;     // Furthest deflection seen each way (grows with use)
+	uint16_t joy_max_x;
+	uint16_t joy_min_y;
+	uint16_t joy_max_y;
+	uint8_t  joy_calibrated;// 1 = centre captured and saved (boot auto-centre is skipped)
 }appConfig_t;
 
+extern appConfig_t AppConfig;
+
 // TaskConfig_t: Handles the task at hand being utilised
 typedef struct
 {
@@ -50,6 +72,8 @@ typedef enum
 
 // Function Definitions
 appStatus_t createTasks(void);
-void SaveHighScore(uint32_t score);
+void SaveHighScore(uint32_t score);    // Queued: persisted by FlashStore_Commit()
 uint32_t LoadHighScore(void);
+void LoadAppConfig(void);
+void SaveAppConfig(void);               // Queued like SaveHighScore
 #endif /* HEADER_APPCONFIG_H_ */
@@ -0,0 +1,39 @@
+#ifndef __BENCHMARK_H
+#define __BENCHMARK_H
+
+#include <stdint.h>
+
+//
+// On-Target Benchmarks (ENABLE_BENCHMARKS in appConfig.h)
+// Times the per-entity hot paths with the DWT cycle counter at boot, before the
+// menu appears. Results stay in RAM for a debugger live-watch and are printed
+// as text over USART2 (ST-Link VCOM, like the replay export). Counts above
+// ENTITY_CAPACITY are skipped; rebuild with -DENTITY_CAPACITY=128 to cover them.
+// The host build (oem/host, make bench) runs the same code with both set.
+//
+#define BENCH_ENTITY_COUNTS     { 5, 32, 128 }
+#define BENCH_CASES             3
+#define BENCH_ITERATIONS        16      // Runs averaged per measurement
+
+typedef struct {
+    uint16_t entities;          // Live entities in this case
+    uint8_t  skipped;           // 1 = above ENTITY_CAPACITY
+    uint32_t ai_cycles;         // Mean cycles for one Game_UpdateAI pass
+    uint32_t sprite_cycles;     // Mean cycles for one Render_Enemies pass
+} BenchResult_t;
+
+// Worst case for the projectile pool: every slot in flight
+typedef struct {
+    uint16_t projectiles;       // PROJECTILE_CAPACITY
+    uint32_t step_cycles;       // Mean cycles for one Projectile_Step
+    uint32_t render_cycles;     // Mean cycles for one Render_Projectiles pass
+} BenchProjectileResult_t;
+
+// Function Prototypes
+void Benchmark_RunEntityScaling(void);     // Caller holds gameMutex; re-init the game afterwards
+void Benchmark_RunProjectiles(void);       // Same contract
+const BenchResult_t* Benchmark_GetResults(void); // BENCH_CASES entries
+const BenchProjectileResult_t* Benchmark_GetProjectileResult(void);
+int Benchmark_ExportUart(void);            // Both tables as text lines; 0 = UART error
+
+#endif /* __BENCHMARK_H */
@@ -0,0 +1,27 @@
+#ifndef __BUTTON_H
+#define __BUTTON_H
+
+#include "stm32f4xx_hal.h"
+#include <stdint.h>
+
+//
+// Fire Button (PA10 / EXTI10)
+// Both edges interrupt; the ISR timestamps them with DWT->CYCCNT and rejects
+// anything inside the lockout window after the last accepted edge.
+//
+#define BUTTON_LOCKOUT_US        5000    // Contact bounce window after an accepted edge
+
+typedef struct {
+    uint32_t accepted_edges;    // Edges forwarded to the input layer
+    uint32_t rejected_bounces;  // Edges swallowed by the lockout / no state change
+    uint32_t resynced_edges;    // Edges recovered by Button_Reconcile after a swallowed release
+    uint32_t last_edge_cycles;  // DWT timestamp of the last accepted edge
+} ButtonStats_t;
+
+// Function Prototypes
+void    Button_Init(void);
+uint8_t Button_IsHeld(void);            // Debounced state (1 = pressed)
+void    Button_Reconcile(void);         // Task context: catches a final edge lost inside the lockout
+void    Button_GetStats(ButtonStats_t *stats);
+
+#endif /* __BUTTON_H */
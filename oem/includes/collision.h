@@ -0,0 +1,23 @@
+#ifndef __COLLISION_H
+#define __COLLISION_H
+
+#include "levels.h"
+#include <stdint.h>
+
+//
+// Circle vs Tile Grid Collision
+// Movers are circles; every non-zero map cell is a solid unit box. A move is
+// split into sub-steps no longer than half the radius (so thin walls cannot be
+// tunnelled), and after each sub-step the circle is pushed out along the
+// contact normal of every solid cell it overlaps. Pushing out only along the
+// normal keeps the tangential part of the motion, which gives wall sliding.
+//
+#define COLLISION_MAX_SUBSTEPS  8       // Longer moves are shortened to 8 sub-steps
+#define COLLISION_PASSES        2       // Push-out passes per sub-step (inside corners)
+
+// Function Prototypes
+void Collision_LoadLevel(const Level_t *level);  // Builds the occupancy bitset
+int  Collision_IsSolid(int cell_x, int cell_y);  // Out-of-map counts as solid
+int  Collision_MoveCircle(float *x, float *y, float dx, float dy, float radius); // 1 = touched a wall
+
+#endif /* __COLLISION_H */
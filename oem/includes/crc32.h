@@ -0,0 +1,34 @@
+#ifndef __CRC32_H
+#define __CRC32_H
+
+#include <stdint.h>
+
+//
+// CRC-32 (IEEE 802.3, reflected 0xEDB88320)
+// Nibble-table software version: 64 bytes of table, no peripheral to clock
+// or share between tasks. Only used on small records, never per frame.
+//
+static inline uint32_t Crc32_Update(uint32_t crc, const void *data, uint32_t len)
+{
+    static const uint32_t nibble[16] = {
+        0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+        0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+        0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+        0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+    };
+    const uint8_t *p = (const uint8_t *)data;
+
+    while (len--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ nibble[crc & 0x0F];
+        crc = (crc >> 4) ^ nibble[crc & 0x0F];
+    }
+    return crc;
+}
+
+static inline uint32_t Crc32(const void *data, uint32_t len)
+{
+    return Crc32_Update(0xFFFFFFFFu, data, len) ^ 0xFFFFFFFFu;
+}
+
+#endif /* __CRC32_H */
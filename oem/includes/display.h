@@ -53,6 +53,7 @@
 void OLED_Init(void);
 void OLED_Update(void);
 void ClearScreen(void);
+void InvertScreen(void);
 void SetPixel(int x, int y, uint8_t color);
 
 // Draing Functions
@@ -0,0 +1,46 @@
+#ifndef __EFFECTS_H
+#define __EFFECTS_H
+
+#include "raycaster.h"
+#include <stdint.h>
+
+//
+// Logic -> Render Effect Commands
+// The logic task describes feedback ("a shot was fired", "the player was hurt")
+// as small commands in a single-producer / single-consumer ring; the render
+// task drains it at the start of every frame and composites the effects into
+// its own frame. Only GameLogicTask pushes (writes 'head') and only RenderTask
+// drains (writes 'tail'), so neither side needs the mutex for the ring itself.
+// Each overlay lives for a number of rendered frames; a retrigger extends it.
+//
+#define EFFECT_QUEUE_LEN        16      // Power of two
+#define EFFECT_SHAKE_AMPLITUDE  0.04f   // Sideways camera jitter in map units
+
+typedef enum {
+    EFFECT_MUZZLE_FLASH,    // Recoil lines beside the crosshair
+    EFFECT_HIT_MARKER,      // Ticks around the crosshair: the shot landed
+    EFFECT_SCREEN_SHAKE,    // Camera jitter (kills)
+    EFFECT_DAMAGE_FLASH,    // Inverted frame: the player took damage
+    EFFECT_BURST,           // Particle burst at (x, y); not an overlay
+    EFFECT_TYPE_COUNT
+} EffectType_t;
+
+typedef struct {
+    uint8_t type;           // EffectType_t
+    uint8_t frames;         // Overlay lifetime in rendered frames
+    uint8_t count;          // EFFECT_BURST: particles to emit
+    float   x, y;           // EFFECT_BURST: world position
+} EffectCmd_t;
+
+// Producer side (GameLogicTask). Full ring = command dropped and counted.
+void Effects_Trigger(EffectType_t type);                 // Overlay with its default lifetime
+void Effects_Burst(float x, float y, uint8_t count);
+uint32_t Effects_GetDropped(void);
+void Effects_SetMuted(uint8_t muted);       // Rollback re-simulation: ticks already shown once
+
+// Consumer side (RenderTask, once per frame in this order)
+void Effects_BeginFrame(void);              // Ages overlays, drains the ring, emits bursts
+void Effects_ApplyCamera(Camera_t *cam);    // Screen shake (before the 3D view)
+void Effects_Composite(void);               // Overlays (after the HUD)
+
+#endif /* __EFFECTS_H */
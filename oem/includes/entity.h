@@ -0,0 +1,60 @@
+#ifndef __ENTITY_H
+#define __ENTITY_H
+
+#include <stdint.h>
+
+//
+// Entity Store (struct-of-arrays)
+// Each field lives in its own array so a pass touching positions only walks
+// positions. Live slots are tracked in a bitmask; loops visit them with a
+// count-trailing-zeros scan and never look at dead slots.
+//
+#ifndef ENTITY_CAPACITY
+#define ENTITY_CAPACITY     32      // Compile-time slot count (override with -DENTITY_CAPACITY=N)
+#endif
+
+#define ENTITY_MASK_WORDS   ((ENTITY_CAPACITY + 31) / 32)
+#define ENTITY_NONE         (-1)
+
+typedef enum {
+    ENTITY_TYPE_ENEMY = 0
+} EntityType_t;
+
+typedef enum {
+    ENTITY_STATE_IDLE = 0,  // Out of range, waiting
+    ENTITY_STATE_CHASE      // Moving toward the player
+} EntityState_t;
+
+typedef struct {
+    float    x[ENTITY_CAPACITY];
+    float    y[ENTITY_CAPACITY];
+    int16_t  health[ENTITY_CAPACITY];
+    uint8_t  type[ENTITY_CAPACITY];
+    uint8_t  state[ENTITY_CAPACITY];
+    uint32_t think_tick[ENTITY_CAPACITY]; // Game.tick of the last AI think (set by the spawner)
+    uint32_t fire_tick[ENTITY_CAPACITY];  // Earliest Game.tick the next ranged attack may happen
+    uint32_t active[ENTITY_MASK_WORDS];   // Bit i set = slot i alive
+    uint16_t count;                       // Popcount of 'active'
+} EntityStore_t;
+
+//
+// Visits every live slot in ascending order: ENTITY_FOREACH(&Game.entities, i) { ... }
+// Killing the current slot inside the body is safe (the word was copied).
+//
+#define ENTITY_FOREACH(store, idx) \
+    for (uint32_t _ew = 0; _ew < ENTITY_MASK_WORDS; _ew++) \
+        for (uint32_t _eb = (store)->active[_ew], idx; \
+             _eb && ((idx = _ew * 32 + (uint32_t)__builtin_ctz(_eb)), 1); \
+             _eb &= _eb - 1)
+
+// Function Prototypes
+void Entity_Clear(EntityStore_t *store);
+int  Entity_Spawn(EntityStore_t *store, EntityType_t type, float x, float y, int16_t health); // Slot or ENTITY_NONE
+void Entity_Kill(EntityStore_t *store, int idx);
+
+static inline int Entity_IsActive(const EntityStore_t *store, int idx)
+{
+    return (store->active[idx >> 5] >> (idx & 31)) & 1;
+}
+
+#endif /* __ENTITY_H */
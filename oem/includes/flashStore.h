@@ -0,0 +1,81 @@
+#ifndef __FLASHSTORE_H
+#define __FLASHSTORE_H
+
+#include <stdint.h>
+
+//
+// Log-Structured Flash Store
+// Sectors 6 and 7 (2 x 128 KB, removed from the FLASH region in the linker
+// script) hold an append-only log of CRC-checked records. A boot scan builds
+// a RAM index of the newest record per key, so reads never walk flash.
+// When the active sector fills, the newest record of every key is copied to
+// the other sector, whose header is programmed last: a power cut mid-copy
+// leaves the old sector active. Erases therefore happen once per sector's
+// worth of records, not once per write, and the two sectors share the wear.
+//
+// Writes only update a RAM shadow; FlashStore_Commit() wakes the persistence
+// task, which programs flash at low priority. Flash reads stall while a
+// sector erases (~1-2 s), so commits are made where a pause is harmless
+// (game over, idle controls), never from the simulation. The game-over commit
+// also compacts early once fewer than FLASH_STORE_RESERVE_RECORDS max-size
+// records fit, and mid-run writers check FlashStore_Fits first, so idle
+// mirrors only ever program: the erase lands on the end screen instead.
+//
+#define FLASH_STORE_SECTOR_A        0x08040000u     // Sector 6
+#define FLASH_STORE_SECTOR_B        0x08060000u     // Sector 7
+#define FLASH_STORE_SECTOR_SIZE     0x20000u        // 128 KB each
+#define FLASH_STORE_MAGIC           0x53465350u     // "PSFS"
+#define FLASH_STORE_MAX_PAYLOAD     1040            // Bytes per record (multiple of 4; fits a game snapshot)
+#define FLASH_STORE_FLAG_COMMIT     0x0001U         // Thread flag raised by FlashStore_Commit
+#define FLASH_STORE_RESERVE_RECORDS 16              // Max-size records kept free for the next run's mirrors
+
+typedef enum {
+    FS_KEY_HIGH_SCORE = 0,
+    FS_KEY_APP_CONFIG,
+    FS_KEY_SNAPSHOT,        // Suspended run (snapshot.h); empty record = none
+    FS_KEY_COUNT
+} FlashStoreKey_t;
+
+typedef enum {
+    FS_OK = 0,
+    FS_ERR_BAD_KEY,
+    FS_ERR_TOO_LARGE,
+    FS_ERR_NOT_FOUND,
+    FS_ERR_FLASH,
+} FlashStoreStatus_t;
+
+// On-flash record header; the payload follows, padded to a word
+typedef struct {
+    uint16_t key;
+    uint16_t len;       // Payload bytes
+    uint32_t seq;       // Store-wide write counter (newest wins)
+    uint32_t crc;       // CRC-32 of key, len, seq and payload
+} FlashRecordHeader_t;
+
+// Debugger live-watch view
+typedef struct {
+    uint32_t active_sector;     // Base address of the sector being appended to
+    uint32_t generation;        // Bumped on every compaction
+    uint32_t bytes_free;        // Left in the active sector
+    uint32_t records_written;
+    uint32_t records_corrupt;   // Failed CRC during the boot scan (torn writes)
+    uint32_t compactions;
+    uint32_t early_compactions; // Of those, made at a reserve commit before the sector was full
+    uint32_t write_errors;
+} FlashStoreStats_t;
+
+// Function Prototypes
+void FlashStore_Init(void);         // Boot: scan the log, build the index (formats on first use)
+FlashStoreStatus_t FlashStore_Read(FlashStoreKey_t key, void *data, uint16_t *len); // *len in: capacity, out: size
+FlashStoreStatus_t FlashStore_Write(FlashStoreKey_t key, const void *data, uint16_t len); // RAM only
+void FlashStore_Commit(void);       // Hand every pending write to the persistence task
+void FlashStore_CommitReserve(void); // Commit, then compact if the reserve no longer fits
+int  FlashStore_Fits(uint16_t len); // 1 = a record of len bytes can be programmed without an erase
+
+// Persistence task side
+void FlashStore_AttachTask(void);   // Calling thread receives FLASH_STORE_FLAG_COMMIT
+void FlashStore_Flush(void);        // Programs every pending write (may erase a sector)
+
+void FlashStore_GetStats(FlashStoreStats_t *stats);
+
+#endif /* __FLASHSTORE_H */
@@ -0,0 +1,54 @@
+#ifndef __FLOWFIELD_H
+#define __FLOWFIELD_H
+
+#include "levels.h"
+#include <stdint.h>
+
+//
+// Flow Field Pathfinding
+// One breadth-first search from the player's cell over Level_t.map gives every
+// open cell its step distance to the player and the neighbour to move to next.
+// Enemies then path around walls with a single table lookup each. The search
+// restarts only when the player enters a new cell and is spread over several
+// logic ticks; until it finishes, the previous (complete) field stays in use.
+// In a linked run the search starts from both players' cells at once, so each
+// cell leads to whichever player is nearer.
+//
+#define FLOW_CELLS          (MAP_W * MAP_H)
+#define FLOW_UNREACHABLE    0xFF    // Distance of walls and sealed-off cells
+#define FLOW_NO_STEP        0xFF    // next[] value when there is nowhere to go (not a direction)
+#define FLOW_CELLS_PER_TICK 64      // BFS expansions per logic tick (full map in 4 ticks)
+
+typedef struct {
+    uint8_t dist[FLOW_CELLS];   // Steps to the target cell (index = x * MAP_H + y)
+    uint8_t next[FLOW_CELLS];   // Direction (0-7) of the neighbour one step closer; a cell
+                                // index would make cell 255 (15,15) read as FLOW_NO_STEP
+    uint8_t target_x, target_y; // Player cell this field leads to
+    uint8_t target_bx, target_by; // Second player cell (same as the first when alone)
+    uint8_t valid;
+} FlowField_t;
+
+//
+// Everything the search carries between ticks. Plain data (indices, no
+// pointers) so it lives in GameState_t and is copied with the rest of the
+// simulation: a restored state continues the exact same build.
+//
+typedef struct {
+    FlowField_t fields[2];      // Double buffered: enemies read 'active' while the other is built
+    uint8_t  active;            // Index of the complete field
+    uint8_t  queue[FLOW_CELLS]; // BFS frontier of the field being built
+    uint16_t q_head, q_tail;
+    uint8_t  build_pending;
+    uint8_t  want_x, want_y;    // Cells the in-progress/last build targets
+    uint8_t  want_bx, want_by;
+} FlowState_t;
+
+// Function Prototypes
+void FlowField_Reset(FlowState_t *flow);                            // Level load / new game
+void FlowField_Update(FlowState_t *flow, const Level_t *level, int player_x, int player_y); // Once per logic tick
+void FlowField_UpdatePair(FlowState_t *flow, const Level_t *level, int ax, int ay, int bx, int by); // Linked runs
+int  FlowField_NextCell(const FlowState_t *flow, int cell_x, int cell_y, int *next_x, int *next_y); // 0 = no path
+uint8_t FlowField_Distance(const FlowState_t *flow, int cell_x, int cell_y);
+const FlowField_t* FlowField_Get(const FlowState_t *flow);
+
+#endif /* __FLOWFIELD_H */
@@ -3,8 +3,51 @@
 #define __GAMELOGIC_H
 
 #include "levels.h"
+#include "input.h"
+#include "raycaster.h"
+#include "entity.h"
+#include "spatial.h"
+#include "projectile.h"
+#include "flowfield.h"
 #include <stdint.h>
 
+// --- Simulation Timestep ---
+#define LOGIC_HZ            50                  // Fixed simulation rate
+#define LOGIC_TICK_MS       (1000 / LOGIC_HZ)   // Must divide evenly into the 1 kHz kernel tick
+#define LOGIC_DT            (1.0f / LOGIC_HZ)   // Seconds per tick
+#define LOGIC_MAX_SUBSTEPS  4                   // Catch-up ticks per wake before ticks are dropped
+
+// --- Tuning (per second, independent of LOGIC_HZ) ---
+#define PLAYER_ROT_SPEED    2.5f    // Radians/s at full stick deflection
+#define PLAYER_MOVE_SPEED   4.0f    // Map units/s at full stick deflection
+#define STICK_DEADZONE      0.15f   // Axis magnitude below which the stick is ignored
+#define LATE_LATCH_MAX_MS   40      // Never extrapolate the camera more than this
+#define PLAYER_RADIUS       0.2f    // Collision circle (map units), keeps the camera off the walls
+#define ENEMY_RADIUS        0.25f
+
+#define AI_THINK_HZ         10                          // Enemy decisions per second
+#define AI_TICK_INTERVAL    (LOGIC_HZ / AI_THINK_HZ)    // Logic ticks between AI thinks
+#define ENEMY_MOVE_SPEED    0.4f    // Map units/s while chasing
+#define ENEMY_CONTACT_DPS   20      // Health lost per second while touching an enemy
+#define ENEMY_HEALTH        3       // Hits to kill
+#define ENEMY_CONTACT_RADIUS    0.775f  // Centre distance that counts as touching the player
+#define ENEMY_SEPARATION_RADIUS 0.5f    // Enemies closer than this push apart (2x ENEMY_RADIUS)
+#define ENEMY_SEPARATION_SPEED  0.6f    // Map units/s of push at full overlap
+#define ENEMY_FIRE_MIN_RANGE    1.5f    // Too close to shoot: contact damage does the work
+#define ENEMY_FIRE_RANGE        7.0f
+#define ENEMY_FIRE_CHANCE_PCT   25      // Per think while off cooldown with a clear shot
+#define ENEMY_FIRE_COOLDOWN_S   2
+#define ARCADE_MIN_ENEMIES  3       // Arcade population when no governor limit is given
+#define LEVEL_TRANSITION_S  5       // Pause between levels (seconds)
+
+// Scheduler health for the fixed-timestep loop
+typedef struct {
+    uint32_t ticks;             // Simulation ticks executed
+    uint32_t overruns;          // Wakes that found at least one deadline already passed
+    uint32_t dropped_ticks;     // Ticks skipped after LOGIC_MAX_SUBSTEPS catch-up steps
+    uint32_t max_substeps;      // Most ticks run back to back in a single wake
+} LogicTimingStats_t;
+
 // --- Game Modes ---
 typedef enum {
     MODE_CLASSIC, // Levels 1 -> 2 -> Win
@@ -24,49 +67,89 @@ typedef enum {
 // --- Menu Options ---
 typedef enum {
     MENU_CLASSIC = 0,
-    MENU_ARCADE  = 1
+    MENU_ARCADE  = 1,
+    MENU_LINK    = 2    // Co-op over the board-to-board link (link.h)
 } MenuOption_t;
 
-// --- Entity Structure ---
 typedef struct {
     float x, y;
-    int active;     // 1 = Alive, 0 = Dead
-    int health;     // HP
-    float distance; // For sorting
-} ActiveEnemy_t;
+    float dir_x, dir_y;
+    float plane_x, plane_y;
+    int health;             // <= 0: down (ignored by enemies, no control)
+} Player_t;
 
+//
 // --- Main Model ---
+// Plain data only: no pointers, nothing the renderer owns. The whole struct
+// is the simulation, so a memcpy of it is a complete save point (rollback.h).
+// The level itself is reached through Game_Level() from the index.
+//
 typedef struct {
     SceneState_t state;
     GameMode_t mode;
 
-    const Level_t* current_level;
     int current_level_idx;
 
-    struct {
-        float x, y;
-        float dir_x, dir_y;
-        float plane_x, plane_y;
-        int health;
-    } player;
+    Player_t player;
+    Player_t partner;           // Second board in a linked run (only simulated when 'linked')
+    uint8_t  linked;
 
     uint32_t current_score;
-    uint32_t high_score;
+    uint32_t high_score;        // Best of the saved record and this run
 
-    // Timer for transitions (ticks at 50Hz)
+    // Timer for transitions (logic ticks)
     int transition_timer;
 
-    ActiveEnemy_t enemies[5];
+    // Determinism: everything below is reset by Game_Init so a replay starts identically
+    uint32_t rng_seed;          // Seed the run started from
+    uint32_t rng_state;         // xorshift32 state (all gameplay randomness draws from this)
+    uint32_t tick;              // Simulation ticks since Game_Init (also paces the AI)
+    uint8_t  ai_cursor;         // Entity slot where the AI round robin resumes
+
+    EntityStore_t entities;
+    SpatialIndex_t grid;        // Entities bucketed by map cell (kept in step by spawn/kill/move)
+    ProjectilePool_t projectiles;
+    FlowState_t flow;           // Pathing toward the player (built over several ticks)
 } GameState_t;
 
+// Outside the simulation: rewinding Game must not move these
+typedef struct {
+    // DWT timestamp of the newest input sample applied to the player (latency tracking)
+    uint32_t input_timestamp;
+    uint8_t  local_player;      // 0 = Game.player, 1 = Game.partner: camera, HUD, own effects
+} GameSession_t;
+
 extern GameState_t Game;
+extern GameSession_t Session;
+
+static inline const Level_t *Game_Level(void)
+{
+    return AllLevels[Game.current_level_idx];
+}
+
+static inline const Player_t *Game_LocalPlayer(void)
+{
+    return Session.local_player ? &Game.partner : &Game.player;
+}
 
 // --- Function Prototypes ---
-void Game_Init(GameMode_t mode);
+void Game_Init(GameMode_t mode, uint32_t seed);
+void Game_InitLinked(GameMode_t mode, uint32_t seed, uint8_t local_player);
 void Game_LoadLevel(int level_index);
-void Game_Update(void);
-void Game_HandleCombat(void);
+void Game_PrepareLevel(int level_index);     // Level tables only (snapshot resume)
+int  Game_SpawnEnemy(float x, float y);
+void Game_KillEnemy(int idx);
+void Game_Update(const InputSnapshot_t *input);
+void Game_HandleCombat(const InputSnapshot_t *input);
 void Game_UpdateAI(void);
+void Game_ThinkEnemy(int idx, uint32_t age);
+void Game_UpdateWorld(const InputSnapshot_t *input);
 void Game_HandleTransition(void);
+void Game_Tick(const InputSnapshot_t *input);
+void Game_TickLinked(const InputSnapshot_t *input, const InputSnapshot_t *partner_input);
+uint32_t Game_StateHash(void);
+void Game_GetCamera(Camera_t *cam);
+int  Game_LateLatchCamera(Camera_t *cam, const InputSample_t *latest);
+void Logic_GetTimingStats(LogicTimingStats_t *stats);
 
 #endif
@@ -0,0 +1,54 @@
+#ifndef __GOVERNOR_H
+#define __GOVERNOR_H
+
+#include <stdint.h>
+
+//
+// Frame-Budget Governor (arcade population)
+// Render and logic report how long their work took; the governor keeps a
+// running average of each and every GOV_EVAL_TICKS compares them with their
+// targets. Over budget: one fewer enemy allowed and slower spawning. Clearly
+// under budget for GOV_RAISE_EVALS evaluations in a row: one more enemy and
+// faster spawning. The limits are handed to the simulation through the input
+// snapshot, so a replay reproduces the exact decisions made live.
+//
+#define GOV_RENDER_TARGET_US    12000   // Drawing per frame, under gameMutex (logic waits: 60% of a tick);
+                                        // the ~25 ms panel flush is fixed and not counted
+#define GOV_LOGIC_TARGET_US     8000    // Game_Tick per tick (40% of a 20 ms tick)
+#define GOV_HEADROOM_PCT        80      // "Clearly under": both below this % of target
+#define GOV_EVAL_TICKS          25      // Re-evaluate every 0.5 s
+#define GOV_RAISE_EVALS         4       // Calm evaluations needed before raising (2 s)
+#define GOV_EWMA_SHIFT          3       // Average weight 1/8 per sample
+
+#define GOV_MIN_ENEMIES         3       // Never fewer than the classic arcade count
+#define GOV_MAX_ENEMIES         12      // Design ceiling (clamped to ENTITY_CAPACITY)
+#define GOV_MIN_SPAWN_INTERVAL  1       // Spawn every AI think at most
+#define GOV_MAX_SPAWN_INTERVAL  7       // Fits the 3-bit replay field
+
+typedef enum {
+    GOV_HOLD = 0,
+    GOV_RAISED,
+    GOV_LOWERED_RENDER,     // Frame time over target
+    GOV_LOWERED_LOGIC       // Tick time over target
+} GovDecision_t;
+
+typedef struct {
+    uint32_t render_avg_us;
+    uint32_t logic_avg_us;
+    uint8_t  entity_cap;        // Current limits
+    uint8_t  spawn_interval;
+    uint8_t  last_decision;     // GovDecision_t of the latest evaluation
+    uint32_t raises;
+    uint32_t lowers;
+} GovernorStats_t;
+
+// Function Prototypes
+void Governor_Reset(void);
+void Governor_ReportRender(uint32_t cycles);    // Render task, once per gameplay frame (drawing only)
+void Governor_ReportLogic(uint32_t cycles);     // Logic task, once per simulation tick
+void Governor_Update(void);                     // Logic task, once per tick
+uint8_t Governor_EntityCap(void);
+uint8_t Governor_SpawnInterval(void);
+void Governor_GetStats(GovernorStats_t *stats);
+
+#endif /* __GOVERNOR_H */
@@ -16,6 +16,17 @@ typedef struct
     uint8_t is_firing;  // 1 = Pressed, 0 = Released
 } PlayerInput_t;
 
+//
+// Latest joystick sample published by InputTask (normalised + timestamped)
+//
+typedef struct
+{
+    float x;            // Range: -1.0 .. 1.0, deadzone already applied
+    float y;            // Range: -1.0 .. 1.0, deadzone already applied
+    uint8_t buttons;    // Bit 0 = Fire held
+    uint32_t timestamp; // DWT cycle count when the sample was taken
+} InputSample_t;
+
 typedef enum {
     EVENT_NONE,
     EVENT_MOVE,
@@ -26,12 +37,39 @@ typedef enum {
 typedef struct {
     InputEventType_t type;
     float x, y; // Joystick values
+    uint32_t timestamp; // DWT cycle count of the edge
 } InputEvent_t;
 
-extern osMessageQueueId_t xInputQueue; // Queue Handle
+#define INPUT_EVENT_QUEUE_LEN  16   // Power of two; edges buffered between logic ticks
+
+//
+// Immutable per-tick view of the input layer
+// Built once at the start of each logic tick by Input_BeginTick. Edge counts
+// cover every press/release since the previous tick, so a tap shorter than a
+// tick still shows up as fire_presses > 0 even though fire_held is 0 again.
+// The governor fields are zeroed here and filled in by the logic task, so the
+// load-dependent limits travel (and replay) with the rest of the input.
+//
+typedef struct
+{
+    float x;                // Latest X axis (-1.0 .. 1.0)
+    float y;                // Latest Y axis (-1.0 .. 1.0)
+    uint8_t fire_held;      // Fire state at the newest sample
+    uint8_t fire_presses;   // Press edges since the previous tick
+    uint8_t fire_releases;  // Release edges since the previous tick
+    uint8_t entity_cap;     // Governor: arcade population limit this tick (0 = default)
+    uint8_t spawn_interval; // Governor: AI thinks between arcade spawns (0 = default)
+    uint32_t timestamp;     // DWT cycle count of the newest sample
+} InputSnapshot_t;
 
 // Function Prototypes
 void Input_Init(void);
+void Input_Poll(void);                          // Producer: sample hardware and publish (InputTask only)
+void Input_Publish(const InputSample_t *sample);
+void Input_GetLatest(InputSample_t *sample);    // Consumer: O(1), never blocks
+void Input_PushEvent(InputEventType_t type, uint32_t timestamp); // Producer only
+void Input_BeginTick(InputSnapshot_t *snapshot);// Consumer: once per logic tick
+uint32_t Input_GetDroppedEvents(void);
 PlayerInput_t Input_ReadState(void);
 
 #endif
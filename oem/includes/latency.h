@@ -0,0 +1,30 @@
+#ifndef __LATENCY_H
+#define __LATENCY_H
+
+#include <stdint.h>
+
+//
+// Input-to-Photon Latency
+// Each input sample carries a DWT timestamp. The game state remembers the
+// newest one it consumed, the render task copies it into the frame it builds,
+// and once OLED_Update has pushed that frame out the elapsed time is recorded
+// (only for the first frame that reflects a given sample).
+//
+#define LATENCY_BUCKET_US        1000    // Histogram resolution (1 ms)
+#define LATENCY_BUCKETS          128     // 0..127 ms, anything slower lands in the last bucket
+
+typedef struct {
+    uint32_t count;         // Frames measured
+    uint32_t min_us;
+    uint32_t mean_us;
+    uint32_t p99_us;        // Upper edge of the bucket holding the 99th percentile
+    uint32_t max_us;
+} LatencyStats_t;
+
+// Function Prototypes
+void Latency_Reset(void);
+void Latency_RecordFrame(uint32_t input_timestamp, uint32_t flush_done); // Render task only
+void Latency_GetStats(LatencyStats_t *stats);
+const uint32_t* Latency_GetHistogram(void); // LATENCY_BUCKETS counters, for live-watch/export
+
+#endif /* __LATENCY_H */
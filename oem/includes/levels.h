@@ -9,6 +9,9 @@
 #define MAP_W 16
 #define MAP_H 16
 
+// Spawn points stored per level (the live cap is ENTITY_CAPACITY)
+#define LEVEL_MAX_ENEMIES 5
+
 // Wall Texture Types (The "4 Colors")
 #define WALL_NONE   0
 #define WALL_SOLID  1 // White
@@ -30,7 +33,7 @@ typedef struct {
     float start_angle;
     // New Enemy Data
     int enemy_count;
-    EnemySpawn_t enemies[5]; // Max 5 enemies per level for performance
+    EnemySpawn_t enemies[LEVEL_MAX_ENEMIES];
 } Level_t;
 
 // extern Level structures
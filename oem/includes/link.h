@@ -0,0 +1,119 @@
+#ifndef __LINK_H
+#define __LINK_H
+
+#include "gameLogic.h"
+#include "input.h"
+#include "linkTransport.h"
+#include <stdint.h>
+
+//
+// Two-Board Lockstep Link
+// Both boards run the same deterministic simulation and exchange nothing but
+// their per-tick inputs. A local input is scheduled LINK_INPUT_DELAY ticks
+// ahead and sent straight away, so by the time a tick is due the peer's input
+// for it has normally arrived; if not, the tick stalls on both boards rather
+// than guessing. Each input packet repeats every input the peer has not yet
+// acknowledged, so a lost or corrupt packet is covered by the next one.
+// Every LINK_HASH_INTERVAL ticks the boards swap Game_StateHash(); a mismatch
+// is a desync and ends the run. While no ticks run (a stall, the end screen)
+// Link_Service sends an ack/resend packet every LINK_KEEPALIVE_MS, so a peer
+// still finishing the run gets what it lacks and neither side times out.
+//
+// Inputs travel quantised exactly as replays store them, and both boards feed
+// the simulation the quantised values. The handshake elects side 0 (drives
+// Game.player, supplies the seed, mode and governor limits) by comparing
+// random nonces; side 1 drives Game.partner.
+//
+// Cost: one INPUT packet per tick each way, 10 + 4 bytes per input carried
+// (~15 bytes/tick measured, 750 B/s, 3% of LINK_UART_BAUD), plus a
+// 13-byte HASH packet per interval. Added latency: LINK_INPUT_DELAY ticks on
+// every input, local ones included, plus any stall when the peer's packet
+// takes longer than that (see LinkStats_t).
+//
+#define LINK_PROTOCOL_VERSION   1
+#define LINK_INPUT_DELAY        3               // Ticks from sampling an input to running it (60 ms)
+#define LINK_WINDOW             16              // Inputs held per side (power of two, > 2 x delay + in flight)
+#define LINK_MAX_RESEND         4               // Unacknowledged inputs carried per packet
+#define LINK_HASH_INTERVAL      LOGIC_HZ        // Ticks between checksum exchanges (1 s)
+#define LINK_HELLO_INTERVAL_MS  200
+#define LINK_KEEPALIVE_MS       100             // Longest gap between packets while RUNNING
+#define LINK_TIMEOUT_MS         3000            // Silence from the peer this long = link lost
+#define LINK_RX_BUFFER          96              // Partial packet assembly (> largest packet)
+
+typedef enum {
+    LINK_OFF,
+    LINK_WAITING,       // Handshake: announcing ourselves until the peer answers
+    LINK_RUNNING,
+    LINK_LOST,          // Peer silent for LINK_TIMEOUT_MS
+    LINK_DESYNC,        // State hashes differed
+} LinkState_t;
+
+// Debugger live-watch view
+typedef struct {
+    uint32_t ticks;             // Ticks run in lockstep
+    uint32_t stall_polls;       // Polls that found the peer's input missing (one each per logic step)
+    uint32_t tx_bytes;
+    uint32_t rx_bytes;
+    uint32_t tx_bytes_per_tick; // tx_bytes / ticks
+    uint32_t tx_packets;
+    uint32_t tx_full;           // Packets the transport had no room for (resent later)
+    uint32_t crc_errors;        // Frames dropped on a bad CRC (and bytes skipped to resync)
+    uint32_t resent_inputs;     // Inputs carried again because no ack had come back
+    uint32_t rtt_us;            // Last input -> ack round trip (includes up to a tick of ack piggyback)
+    uint32_t rtt_max_us;
+    uint32_t added_latency_ms;  // LINK_INPUT_DELAY in ms plus the average stall per tick
+    uint32_t hash_checks;       // Checkpoints compared with the peer
+    uint32_t desync_tick;       // First tick whose hash differed (0 = none)
+} LinkStats_t;
+
+typedef struct {
+    LinkState_t state;
+    const LinkTransport_t *io;
+
+    // Handshake / run parameters (valid once RUNNING)
+    uint32_t nonce, peer_nonce;
+    uint32_t seed;
+    uint8_t  mode;              // GameMode_t
+    uint8_t  side;              // 0 = Game.player, 1 = Game.partner
+    uint8_t  peer_heard;        // Got the peer's HELLO
+    uint8_t  peer_heard_us;     // The peer has got ours
+
+    // Input windows: tick t lives in slot t & (LINK_WINDOW - 1), 4 packed bytes each
+    uint8_t  local_in[LINK_WINDOW][4];
+    uint8_t  remote_in[LINK_WINDOW][4];
+    uint32_t local_stamp[LINK_WINDOW];  // DWT time of each local sample (latency tracking)
+    uint32_t sent_at[LINK_WINDOW];      // DWT time each local input was first sent
+    uint32_t run_tick;          // Next tick to run
+    uint32_t local_next;        // Next tick to fill with a local input
+    uint32_t remote_next;       // Next tick we lack from the peer (our ack)
+    uint32_t peer_acked;        // Local inputs below this have reached the peer
+    uint32_t sent_next;         // Local inputs below this have been sent at least once
+    uint32_t ack_sent;          // Our ack as of the last packet sent
+    uint8_t  carry_presses, carry_releases; // Fire edges sampled while stalled
+
+    // Checksums
+    uint32_t local_hash_tick, local_hash;
+    uint32_t peer_hash_tick, peer_hash;
+
+    uint32_t last_rx;           // DWT time of the last good packet
+    uint32_t last_hello;
+    uint32_t last_tx;           // DWT time of the last packet sent
+    uint8_t  rx[LINK_RX_BUFFER];
+    uint8_t  rx_len;
+
+    LinkStats_t stats;
+} LinkSession_t;
+
+// Function Prototypes (logic task)
+void Link_Start(LinkSession_t *s, const LinkTransport_t *io, GameMode_t mode, uint32_t seed);
+void Link_Stop(LinkSession_t *s);
+LinkState_t Link_Service(LinkSession_t *s);  // Every logic step while not OFF: receive, handshake, keepalive, timeouts
+
+// RUNNING only. Queues 'local' for a tick LINK_INPUT_DELAY ahead and returns 1
+// with the inputs of the next tick in player order; 0 = stall (peer not in yet).
+int  Link_NextTick(LinkSession_t *s, const InputSnapshot_t *local, InputSnapshot_t *p0, InputSnapshot_t *p1);
+void Link_EndTick(LinkSession_t *s);         // After Game_TickLinked: hash checkpoints
+
+void Link_GetStats(const LinkSession_t *s, LinkStats_t *stats);
+
+#endif /* __LINK_H */
@@ -0,0 +1,40 @@
+#ifndef __LINKTRANSPORT_H
+#define __LINKTRANSPORT_H
+
+#include <stdint.h>
+
+//
+// Byte Transports for the Board Link
+// The lockstep session (link.h) only ever pushes and pulls bytes through one
+// of these, so the same protocol runs over the real cable, an in-memory pipe
+// or, on the host, a pipe/socketpair between two simulator processes.
+// Neither call may block: both run from the logic task once per tick.
+//
+#define LINK_UART_BAUD          230400  // USART6: PC6 TX -> other board's PC7 RX (and back), common GND
+#define LINK_UART_RING          256     // Bytes per direction (power of two)
+#define LINK_LOOPBACK_RING      256     // Bytes per direction (power of two)
+
+typedef struct {
+    int      (*send)(void *ctx, const uint8_t *data, uint16_t len);  // 1 = all queued, 0 = no room (none queued)
+    uint16_t (*recv)(void *ctx, uint8_t *data, uint16_t max);        // Bytes copied out (0 = nothing yet)
+    void     *ctx;
+} LinkTransport_t;
+
+// Two ends of an in-memory cable: what end 0 sends, end 1 receives and vice versa
+typedef struct {
+    uint8_t  ring[2][LINK_LOOPBACK_RING];   // ring[n] carries bytes sent by end n
+    volatile uint16_t head[2], tail[2];
+    LinkTransport_t end[2];
+} LinkLoopback_t;
+
+// Function Prototypes
+void LinkLoopback_Init(LinkLoopback_t *loop);
+
+#ifdef HOST_BUILD
+void LinkFd_Init(LinkTransport_t *t, int *fd);     // Non-blocking pipe/socketpair end ('fd' must outlive 't')
+#else
+const LinkTransport_t *LinkUart_Init(void);        // Configures USART6 + its IRQ (first call only)
+uint32_t LinkUart_GetOverruns(void);               // RX bytes lost: ring full or hardware overrun
+#endif
+
+#endif /* __LINKTRANSPORT_H */
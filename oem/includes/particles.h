@@ -0,0 +1,45 @@
+#ifndef __PARTICLES_H
+#define __PARTICLES_H
+
+#include <stdint.h>
+
+//
+// Hit / Death Particles
+// Purely visual, so the pool is owned by the render side and stepped once per
+// frame with the measured frame time; it is not part of GameState_t and never
+// touches the simulation RNG or the state hash. Same struct-of-arrays + live
+// bitmask layout as the projectile pool, with positions and velocities in
+// Q8.8 fixed point (the map is 16x16, so int16 covers it with room to spare).
+// Per-frame cost is bounded by PARTICLE_CAPACITY: one step, one projection and
+// at most PARTICLE_MAX_DOT^2 pixel writes per particle.
+//
+#define PARTICLE_CAPACITY       32      // <= 32 (one mask word)
+#define PARTICLE_FRAC_BITS      8
+#define PARTICLE_ONE            (1 << PARTICLE_FRAC_BITS)
+#define PARTICLE_GRAVITY        (3 * PARTICLE_ONE)  // Height units/s^2 (1.0 = wall height)
+#define PARTICLE_LIFE_MS        600     // Age at which a particle is culled
+#define PARTICLE_MAX_DT_MS      100     // Clamp after a stall so nothing jumps through a wall
+#define PARTICLE_MAX_DOT        2       // Largest dot edge in pixels (close to the camera)
+#define PARTICLE_HIT_COUNT      4       // Burst when an enemy is hit
+#define PARTICLE_DEATH_COUNT    12      // Burst when an enemy dies
+
+typedef struct {
+    int16_t  x[PARTICLE_CAPACITY];      // Map units, Q8.8
+    int16_t  y[PARTICLE_CAPACITY];
+    int16_t  z[PARTICLE_CAPACITY];      // Height above the floor, Q8.8 (eye level = 0.5)
+    int16_t  vx[PARTICLE_CAPACITY];     // Units/s, Q8.8
+    int16_t  vy[PARTICLE_CAPACITY];
+    int16_t  vz[PARTICLE_CAPACITY];
+    uint16_t age[PARTICLE_CAPACITY];    // ms since emission
+    uint32_t active;                    // Bit i set = slot i live
+    uint8_t  count;
+    uint8_t  dropped;                   // Emissions lost to a full pool (debug watch)
+    uint32_t rng;                       // Private xorshift state (spread directions)
+} ParticlePool_t;
+
+// Function Prototypes (RenderTask only; the logic side asks via Effects_Burst)
+void Particles_Emit(float x, float y, int count); // Burst at eye height; extras dropped when full
+void Particles_Step(uint32_t dt_ms);              // Render task, once per frame
+const ParticlePool_t *Particles_Get(void);
+
+#endif /* __PARTICLES_H */
@@ -0,0 +1,40 @@
+#ifndef __PROJECTILE_H
+#define __PROJECTILE_H
+
+#include <stdint.h>
+
+//
+// Enemy Projectile Pool
+// Fixed-size struct-of-arrays pool with a live bitmask, same layout as the
+// entity store: no allocation, lowest free slot first (deterministic), and a
+// full pool simply drops the shot. Worst-case work per tick and per frame is
+// therefore bounded by PROJECTILE_CAPACITY.
+//
+#define PROJECTILE_CAPACITY     16      // <= 32 (one mask word)
+#define PROJECTILE_SPEED        3.0f    // Map units/s
+#define PROJECTILE_LIFETIME_S   4       // Despawn after this long even if nothing was hit
+#define PROJECTILE_HIT_RADIUS   0.3f    // Centre distance that counts as hitting the player
+#define PROJECTILE_DAMAGE       5       // Health per hit
+#define PROJECTILE_MAX_TARGETS  2       // Players a step tests against (linked runs have two)
+
+typedef struct {
+    float    x[PROJECTILE_CAPACITY];
+    float    y[PROJECTILE_CAPACITY];
+    float    vx[PROJECTILE_CAPACITY];   // Map units per tick
+    float    vy[PROJECTILE_CAPACITY];
+    uint16_t ttl[PROJECTILE_CAPACITY];  // Ticks left
+    uint32_t active;                    // Bit i set = slot i in flight
+    uint8_t  count;
+} ProjectilePool_t;
+
+// Function Prototypes
+void Projectile_Clear(ProjectilePool_t *pool);
+int  Projectile_Spawn(ProjectilePool_t *pool, float x, float y, float dir_x, float dir_y); // Slot or -1 if full
+
+// Advances every projectile one logic tick; wall hits despawn (occupancy grid),
+// player hits despawn and are counted per player in hits[] (the first target
+// tested wins a shot both touch). Returns the total number of player hits.
+int  Projectile_Step(ProjectilePool_t *pool, const float *target_x, const float *target_y,
+                     int targets, uint8_t *hits);
+
+#endif /* __PROJECTILE_H */
@@ -0,0 +1,58 @@
+#ifndef __PVS_H
+#define __PVS_H
+
+#include "levels.h"
+#include <stdint.h>
+
+//
+// Potentially Visible Set
+// Every pair of open cells is tested for line of sight (rays between sample
+// points of both cells, walked through the level map). The result is a
+// 256 x 256 bit matrix: one row per cell, one bit per cell it can see.
+// Renderer and AI then cull in O(1) per entity. Conservative only up to the
+// sampling: a cell pair counts as visible as soon as any sample ray gets
+// through.
+//
+// The matrices are computed ahead of time, one per level, into the const
+// tables in pvsTables.c (generated by the host build: make -C oem/host pvs),
+// so a level load or a resume only selects one. Each table carries the CRC
+// of the map and sampling it was built from; a level that no longer matches
+// its table loads with culling off (everything visible) instead of wrong.
+//
+#define PVS_CELLS           (MAP_W * MAP_H)
+#define PVS_ROW_WORDS       (PVS_CELLS / 32)
+#define PVS_SAMPLE_INSET    0.05f   // Corner samples sit this far inside the cell
+
+typedef struct {
+    uint32_t source_crc;        // Level map + sampling pattern
+    uint16_t open_cells;
+    uint32_t visible_pairs;     // Unordered open-cell pairs with line of sight
+    uint32_t rows[PVS_CELLS][PVS_ROW_WORDS];
+} PvsTable_t;
+
+extern const PvsTable_t PvsTables[];
+extern const int PVS_TABLE_COUNT;
+
+typedef struct {
+    uint32_t load_us;           // Time Pvs_LoadLevel took at the last level load
+    uint8_t  stale;             // 1 = no table matched the level: culling is off
+    uint32_t bytes;             // Flash held by all the tables
+    uint16_t open_cells;
+    uint32_t visible_pairs;
+} PvsStats_t;
+
+// Function Prototypes
+void Pvs_LoadLevel(int level_index, const Level_t *level);
+void Pvs_GetStats(PvsStats_t *stats);
+
+//
+// 1 if anything in cell (bx, by) may be visible from cell (ax, ay)
+//
+int  Pvs_CanSee(int ax, int ay, int bx, int by);
+
+#ifdef HOST_BUILD
+uint32_t Pvs_SourceCrc(const Level_t *level);
+void Pvs_Compute(const Level_t *level, PvsTable_t *table);   // The generator's (slow) full build
+#endif
+
+#endif /* __PVS_H */
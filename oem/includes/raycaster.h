@@ -1,6 +1,7 @@
 #ifndef __RAYCASTER_H
 #define __RAYCASTER_H
 
+#include "particles.h"
 #include <stdint.h>
 
 //
@@ -9,6 +10,7 @@
 #define FOV_SCALE           0.66f   // Adjusts the Field of View (0.66 is standard Doom/Wolf3D)
 #define MAX_RENDER_DIST     16.0f   // How far the player can see before fog/darkness
 #define WALL_HEIGHT_FACTOR  1.0f    // Scaling factor for wall height on screen
+#define NEAR_PLANE_DIST     0.05f   // Wall distances are clamped to this (line height stays bounded)
 
 //
 // Texturing / Dithering Distance Thresholds
@@ -17,13 +19,65 @@
 #define DIST_DITHER         8.0f    // Use checkerboard if closer than 8 units
 #define DIST_SPARSE         12.0f   // Use dots if closer than 12 units
 
+//
+// Batched Ray Queries
+//
+#define RAY_MAX_STEPS       34      // Default DDA cell budget (enough to cross the 16x16 map diagonally)
+#define RAY_MISS_DIST       20.0f   // Distance reported when no wall is found within the budget
+#define RAY_BATCH_MAX       16      // Largest batch accepted in a single call
+
+//
+// One batch = N rays from a shared origin and basis.
+// Ray i points along (dir + plane * offsets[i]), so fans and pellet spreads
+// need no sinf/cosf. Distances come back in units of that ray vector, which is
+// the perpendicular (fisheye-free) distance when the basis is the camera.
+//
+typedef struct {
+    float origin_x, origin_y;
+    float dir_x, dir_y;       // Central ray direction
+    float plane_x, plane_y;   // Spread axis (the camera plane for view-space fans)
+    uint8_t max_steps;        // DDA cell budget per ray (0 = RAY_MAX_STEPS)
+} RayBatch_t;
+
+typedef struct {
+    float   distance;         // Distance to the first solid cell, RAY_MISS_DIST on a miss
+    int8_t  cell_x, cell_y;   // Map cell where the ray stopped
+    uint8_t tile;             // Map value of the hit cell (0 = no wall within budget/bounds)
+    uint8_t side;             // 0 = X face, 1 = Y face
+} RayHit_t;
+
+//
+// Late Latch
+// When enabled, the render task re-reads the freshest joystick sample right
+// before drawing and applies the yaw the player has commanded since the last
+// logic tick to its local camera copy. Game logic stays authoritative.
+//
+#define RENDER_LATE_LATCH   1
+
 // ==================== Raycaster API ====================
 
+//
+// Camera pose used for one frame (a render-side copy of the player pose)
+//
+typedef struct {
+    float x, y;
+    float dir_x, dir_y;
+    float plane_x, plane_y;
+} Camera_t;
+
+//
+// World position of one enemy sprite for the current frame
+//
+typedef struct {
+    float x, y;
+    uint8_t active;
+} SpritePos_t;
+
 //
 // Performs a full frame render using the Digital Differential Analyzer (DDA)
 // Calculates wall distances for all 128 horizontal columns of the OLED
 //
-void Render_3D_View(void);
+void Render_3D_View(const Camera_t *cam);
 
 //
 // Helper function to cast a single ray at a specific angle
@@ -31,4 +85,41 @@ void Render_3D_View(void);
 //
 float Raycast_CastSingle(float angle, uint8_t *hit_type);
 
+//
+// Casts 'count' rays (max RAY_BATCH_MAX) sharing one origin/basis setup.
+// Returns the number of rays that hit a wall.
+//
+int Raycast_CastBatch(const RayBatch_t *batch, const float *offsets, RayHit_t *hits, int count);
+
+//
+// Returns 1 if no wall lies on the segment between the two points.
+// Used for enemy line-of-sight and hitscan occlusion.
+//
+int Raycast_LineOfSight(float x0, float y0, float x1, float y1);
+
+//
+// Draws enemy sprites using the Z-Buffer filled by Render_3D_View
+//
+void Render_Enemies(const Camera_t *cam, const SpritePos_t *sprites, int count);
+
+//
+// Draws the other board's player in a linked run (same billboard as an enemy)
+//
+void Render_Ally(const Camera_t *cam, const SpritePos_t *ally);
+
+//
+// Draws projectiles as small filled billboards, Z-tested like the enemy sprites
+//
+void Render_Projectiles(const Camera_t *cam, const SpritePos_t *shots, int count);
+
+//
+// Draws hit/death particles as dots, Z-tested against the same buffer
+//
+void Render_Particles(const Camera_t *cam, const ParticlePool_t *pool);
+
+//
+// Rotates a camera's direction and plane by 'angle' radians
+//
+void Camera_Rotate(Camera_t *cam, float angle);
+
 #endif /* __RAYCASTER_H */
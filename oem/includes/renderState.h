@@ -0,0 +1,42 @@
+#ifndef __RENDERSTATE_H
+#define __RENDERSTATE_H
+
+#include "raycaster.h"
+#include "entity.h"
+#include "projectile.h"
+#include <stdint.h>
+
+//
+// Render-Side Pose Interpolation
+// After every logic tick the game task publishes the player, ally, enemy and projectile poses
+// together with the DWT time the tick completed; the previous tick's poses are
+// kept alongside. The render task draws one tick in the past, blending between
+// the two so motion stays smooth although logic (50Hz) and render (~30Hz) are
+// not synchronised. Both sides run under gameMutex.
+//
+#define RENDER_MAX_SPRITES      ENTITY_CAPACITY // One sprite per entity slot
+#define RENDER_INTERP_ENABLE    1       // 0 = draw the newest tick as-is
+
+typedef struct {
+    uint32_t blended;       // Frames drawn between two ticks (0 < t < 1)
+    uint32_t held;          // Target at or past the newest tick: drawn as-is (t = 1)
+    uint32_t clamped;       // Target before the older tick: drawn at it (t = 0)
+} RenderStateStats_t;
+
+typedef struct {
+    Camera_t    camera;
+    SpritePos_t sprites[RENDER_MAX_SPRITES];
+    SpritePos_t shots[PROJECTILE_CAPACITY];
+    SpritePos_t ally;       // The other board's player (linked runs only)
+    uint32_t    tick;       // Game.tick this pose belongs to
+    uint32_t    stamp;      // DWT cycles when the tick was published
+} PoseFrame_t;
+
+// Function Prototypes
+void RenderState_Publish(void);     // Logic task, after each simulation tick
+void RenderState_Reset(void);       // Forget history (new game / level load)
+int  RenderState_Interpolate(uint32_t sample_time, Camera_t *cam, SpritePos_t *sprites,
+                             SpritePos_t *shots, SpritePos_t *ally); // 0 = no history, live pose returned
+void RenderState_GetStats(RenderStateStats_t *stats);
+
+#endif /* __RENDERSTATE_H */
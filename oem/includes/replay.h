@@ -0,0 +1,72 @@
+#ifndef __REPLAY_H
+#define __REPLAY_H
+
+#include "input.h"
+#include "gameLogic.h"
+#include <stdint.h>
+
+//
+// Deterministic Input Recording / Replay
+// A recording is the game mode, the RNG seed and the per-tick input stream,
+// delta encoded into a fixed RAM buffer. Playing it back through Game_Tick
+// from the same seed reproduces the same GameState_t trajectory; periodic
+// state hashes are stored in the stream and checked during playback. Runs
+// are recorded with the AI scheduler in budget mode: the ticks where the
+// budget cut the round robin short are stored too and replayed exactly.
+//
+#define REPLAY_BUFFER_SIZE       12288   // Stream bytes (>= 4 min of constant stick motion at 50Hz)
+#define REPLAY_HASH_INTERVAL     (5 * LOGIC_HZ) // Ticks between embedded state hashes (5 s)
+#define REPLAY_MAGIC             0x59504C52u // "RLPY"
+#define REPLAY_FORMAT_VERSION    8
+#define REPLAY_AUTO_RECORD       1       // Record every run
+
+typedef enum {
+    REPLAY_IDLE,
+    REPLAY_RECORDING,
+    REPLAY_PLAYING
+} ReplayMode_t;
+
+// Exported header (little endian, followed by 'data_len' stream bytes)
+typedef struct {
+    uint32_t magic;
+    uint8_t  version;
+    uint8_t  mode;          // GameMode_t
+    uint16_t reserved;
+    uint32_t seed;
+    uint32_t ticks;
+    uint32_t final_hash;    // Game_StateHash() after the last tick
+    uint32_t data_len;
+} ReplayHeader_t;
+
+typedef struct {
+    ReplayMode_t mode;
+    uint32_t ticks;             // Ticks recorded / played so far
+    uint32_t bytes_used;
+    uint8_t  overflowed;        // Recording stopped early: buffer full
+    uint8_t  verified;          // Playback finished with every hash matching
+    uint32_t first_mismatch;    // Tick of the first hash mismatch (0 = none)
+} ReplayStatus_t;
+
+// Function Prototypes
+void Replay_StartRecording(GameMode_t mode, uint32_t seed);
+void Replay_StopRecording(void);
+int  Replay_StartPlayback(GameMode_t *mode, uint32_t *seed); // 0 if no valid recording
+void Replay_StopPlayback(void);
+
+// Call around every Game_Tick: BeginTick records or substitutes the input,
+// EndTick embeds/checks state hashes. BeginTick returns 0 when playback ran out.
+int  Replay_BeginTick(InputSnapshot_t *input);
+void Replay_EndTick(void);
+
+ReplayMode_t Replay_GetMode(void);
+void Replay_GetStatus(ReplayStatus_t *status);
+
+// Export: header + stream over USART2 (blocking, call outside the game mutex)
+int  Replay_ExportUart(void);
+
+#ifdef HOST_BUILD
+int  Replay_LoadFile(const char *path);
+int  Replay_SaveFile(const char *path);
+#endif
+
+#endif /* __REPLAY_H */
@@ -0,0 +1,37 @@
+#ifndef __RNG_H
+#define __RNG_H
+
+#include <stdint.h>
+
+//
+// xorshift32 PRNG
+// The whole generator is one uint32_t that lives in GameState_t, so it is
+// reset by Game_Init, captured by the state hash and restored with the rest
+// of the simulation. No locks, no newlib reentrancy struct.
+//
+
+static inline uint32_t Rng_Seed(uint32_t seed)
+{
+    // xorshift has a fixed point at zero
+    return seed ? seed : 0x9E3779B9u;
+}
+
+static inline uint32_t Rng_Next(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+//
+// Uniform value in [0, n) without a divide (multiply-high range reduction)
+//
+static inline uint32_t Rng_Range(uint32_t *state, uint32_t n)
+{
+    return (uint32_t)(((uint64_t)Rng_Next(state) * n) >> 32);
+}
+
+#endif /* __RNG_H */
@@ -0,0 +1,51 @@
+#ifndef __ROLLBACK_H
+#define __ROLLBACK_H
+
+#include "gameLogic.h"
+#include "input.h"
+#include <stdint.h>
+
+//
+// Rollback Save Points
+// GameState_t is plain data, so a save point is one memcpy of Game plus the
+// input the next tick consumes. A ring keeps the last ROLLBACK_DEPTH ticks:
+// Rollback_Restore() rewinds Game to the start of any tick still held, and
+// Rollback_Resimulate() additionally re-runs the stored inputs back to the
+// present, which is how a late or corrected input (Rollback_SetInput) is
+// folded into the run. Level tables are rebuilt only when the restored state
+// sits on another level. Re-run ticks think the full AI quota, so they are
+// exact unless the AI budget cut the original tick short (AI_SCHED_BUDGET).
+//
+// Nothing calls Restore or Resimulate yet, so the ring is built only with
+// ENABLE_ROLLBACK (appConfig.h); the host simCheck turns it on to test it.
+//
+#define ROLLBACK_DEPTH      8       // Ticks held (power of two): 160 ms at 50 Hz
+
+typedef struct {
+    InputSnapshot_t input;      // Input Game_Tick consumed from this state
+    GameState_t     state;      // Game at the start of the tick (state.tick)
+} RollbackFrame_t;
+
+// Debugger live-watch view
+typedef struct {
+    uint32_t bytes_per_tick;    // sizeof(RollbackFrame_t)
+    uint32_t saves;
+    uint32_t save_cycles;       // DWT cycles of the last save (memcpy)
+    uint32_t restores;
+    uint32_t restore_cycles;    // Last restore, level rebuild included
+    uint32_t resim_ticks;       // Ticks re-run by the last Rollback_Resimulate
+    uint32_t resim_cycles;      // Whole last re-simulation, restore included
+    uint32_t resim_tick_cycles; // Its average per re-run tick
+} RollbackStats_t;
+
+// Function Prototypes (logic task, gameMutex held)
+void Rollback_Reset(void);                                  // New run / resume: forget every save point
+void Rollback_SaveTick(const InputSnapshot_t *input);       // Right before Game_Tick(input)
+int  Rollback_Holds(uint32_t tick);                         // 1 = the start of 'tick' can be restored
+int  Rollback_SetInput(uint32_t tick, const InputSnapshot_t *input); // Replace a stored input (0 = not held)
+int  Rollback_Restore(uint32_t tick);                       // Rewind; later save points are dropped
+int  Rollback_Resimulate(uint32_t tick);                    // Rewind to 'tick', re-run to the present
+
+void Rollback_GetStats(RollbackStats_t *stats);
+
+#endif /* __ROLLBACK_H */
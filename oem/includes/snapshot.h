@@ -0,0 +1,67 @@
+#ifndef __SNAPSHOT_H
+#define __SNAPSHOT_H
+
+#include "gameLogic.h"
+#include "version.h"
+#include <stdint.h>
+
+//
+// Suspend / Resume
+// The simulation is serialised into a compact, versioned image: scene, level
+// index, player, score, RNG, tick, and only the live enemy and projectile
+// slots. Level-derived tables (occupancy, spawn cells, flow field, the
+// level's const PVS table) and the spatial index are rebuilt on resume, so
+// they are not stored. None of that is a full rebuild: the PVS is a table pick.
+//
+// Fast path: two images alternate in a .noinit RAM section, which the startup
+// code leaves alone, so a reset (watchdog, button, debugger) resumes from the
+// newest image with a valid CRC. Fallback: on idle the newest image is queued
+// to the flash store, which survives a power cycle. Either copy is rejected
+// unless it was written by the same version.h build and snapshot format.
+//
+#define SNAPSHOT_MAGIC              0x50414E53u // "SNAP"
+#define SNAPSHOT_FORMAT_VERSION     1
+#define SNAPSHOT_BUILD_ID           (((uint32_t)MAJOR_VERSION << 16) | ((uint32_t)MINOR_VERSION << 8) | PATCH_VERSION)
+#define SNAPSHOT_RAM_INTERVAL       (LOGIC_HZ / 5)  // Ticks between RAM images (<= 200 ms lost on reset)
+#define SNAPSHOT_IDLE_S             3               // Untouched controls this long = idle: mirror to flash
+#define SNAPSHOT_MAX_PAYLOAD        1024
+
+typedef struct {
+    uint32_t magic;
+    uint32_t build;         // SNAPSHOT_BUILD_ID of the writer
+    uint16_t format;        // SNAPSHOT_FORMAT_VERSION
+    uint16_t length;        // Payload bytes
+    uint32_t seq;           // Newer image wins between the two RAM slots
+    uint32_t crc;           // CRC-32 of the payload
+} SnapshotHeader_t;
+
+typedef struct {
+    SnapshotHeader_t header;
+    uint8_t payload[SNAPSHOT_MAX_PAYLOAD];
+} SnapshotImage_t;
+
+// Debugger live-watch view
+typedef struct {
+    uint32_t saves;
+    uint32_t save_cycles;   // DWT cycles of the last RAM save (serialise + CRC)
+    uint32_t mirrors;       // Images queued to flash
+    uint32_t mirrors_skipped; // Not queued: the flash sector would need an erase mid-run
+    uint32_t resume_us;     // Last successful resume, validation to rebuilt level
+    uint8_t  resumed_from;  // 0 = nothing, 1 = RAM, 2 = flash
+    uint32_t rejected;      // Images found but refused (CRC, build, format, contents)
+    uint16_t bytes;         // Payload size of the last save
+} SnapshotStats_t;
+
+// Function Prototypes (logic task, gameMutex held)
+void Snapshot_SaveRam(void);        // Serialise Game into the older RAM slot
+void Snapshot_MirrorToFlash(void);  // Queue the newest RAM image if it fits unerased (caller commits)
+void Snapshot_Invalidate(void);     // Run over: forget RAM and flash images (caller commits)
+int  Snapshot_Resume(void);         // Boot: RAM, then flash. 1 = Game holds the restored run
+
+void Snapshot_GetStats(SnapshotStats_t *stats);
+
+#ifdef HOST_BUILD
+void Snapshot_PowerCycle(void);     // Forget the RAM images: only the flash copy survives
+#endif
+
+#endif /* __SNAPSHOT_H */
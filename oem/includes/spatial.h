@@ -0,0 +1,40 @@
+#ifndef __SPATIAL_H
+#define __SPATIAL_H
+
+#include "levels.h"
+#include "entity.h"
+#include <stdint.h>
+
+//
+// Uniform Grid Spatial Index
+// Entities are bucketed by the map cell they stand in. Each cell holds the
+// head of a doubly-linked list threaded through per-entity next/prev slots, so
+// insert, remove and cell-to-cell moves are O(1) and touch no other entity.
+// A radius query only walks the lists of the cells its bounding box covers.
+//
+#define SPATIAL_CELLS       (MAP_W * MAP_H)
+#define SPATIAL_NONE        0xFF    // Empty list / entity not indexed
+
+#if ENTITY_CAPACITY >= SPATIAL_NONE
+#error "Spatial index links are 8-bit: ENTITY_CAPACITY must stay below 255"
+#endif
+
+typedef struct {
+    uint8_t head[SPATIAL_CELLS];        // First entity in each cell (x * MAP_H + y)
+    uint8_t next[ENTITY_CAPACITY];
+    uint8_t prev[ENTITY_CAPACITY];
+    uint8_t cell[ENTITY_CAPACITY];      // Cell the entity is filed under
+} SpatialIndex_t;
+
+// Function Prototypes
+void Spatial_Clear(SpatialIndex_t *grid);
+void Spatial_Insert(SpatialIndex_t *grid, int idx, float x, float y);
+void Spatial_Remove(SpatialIndex_t *grid, int idx);
+void Spatial_Move(SpatialIndex_t *grid, int idx, float x, float y); // Relinks only on a cell change
+
+// Entities whose centre lies within 'radius' of (x, y); fills up to 'max' indices, returns the count found
+int  Spatial_QueryRadius(const SpatialIndex_t *grid, const EntityStore_t *ents,
+                         float x, float y, float radius, uint8_t *out, int max);
+int  Spatial_CellCount(const SpatialIndex_t *grid, int cell_x, int cell_y);
+
+#endif /* __SPATIAL_H */
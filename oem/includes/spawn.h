@@ -0,0 +1,35 @@
+#ifndef __SPAWN_H
+#define __SPAWN_H
+
+#include "levels.h"
+#include "spatial.h"
+#include <stdint.h>
+
+//
+// Spawn Director
+// Every open cell of the level is listed once at load. A spawn draws listed
+// cells uniformly from the game's PRNG until one is neither near the player
+// nor already holding an entity (usually the first draw). After
+// SPAWN_MAX_DRAWS misses the valid cells are gathered into a candidate list
+// and one is drawn from that, so every valid cell is equally likely and a
+// spawn succeeds whenever any valid cell exists.
+//
+#define SPAWN_MIN_PLAYER_CELLS  3   // Chebyshev distance (cells) kept clear around the player
+#define SPAWN_MAX_DRAWS         8   // Rejection-sampling tries before the full scan
+
+typedef struct {
+    uint32_t picks;             // Successful Spawn_PickCell calls
+    uint32_t rejected_draws;    // Draws that hit an invalid cell
+    uint32_t full_scans;        // Picks that fell back to the candidate list
+} SpawnStats_t;
+
+// Function Prototypes
+void Spawn_LoadLevel(const Level_t *level);
+int  Spawn_FreeCellCount(void);
+void Spawn_GetStats(SpawnStats_t *stats);
+
+// Picks a spawn cell; returns 0 only if no listed cell is currently valid
+int  Spawn_PickCell(uint32_t *rng, const SpatialIndex_t *grid, int player_cx, int player_cy,
+                    int *cell_x, int *cell_y);
+
+#endif /* __SPAWN_H */
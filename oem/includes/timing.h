@@ -0,0 +1,35 @@
+#ifndef __TIMING_H
+#define __TIMING_H
+
+#include "stm32f4xx_hal.h"
+#include <stdint.h>
+
+//
+// DWT Cycle Counter Helpers
+// CYCCNT runs at the core clock (84 MHz -> wraps every ~51 s), so always
+// compare timestamps by unsigned subtraction: (later - earlier).
+//
+
+static inline void Timing_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // Enable the trace block (DWT lives behind it)
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t Timing_Now(void)
+{
+    return DWT->CYCCNT;
+}
+
+static inline uint32_t Timing_CyclesToUs(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000u);
+}
+
+static inline uint32_t Timing_UsToCycles(uint32_t us)
+{
+    return us * (SystemCoreClock / 1000000u);
+}
+
+#endif /* __TIMING_H */
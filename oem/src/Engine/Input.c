@@ -1,73 +1,297 @@
 #include "input.h"
+#include "button.h"
+#include "timing.h"
+#include "appConfig.h"
+#include "flashStore.h"
 #include <math.h>
 #include "cmsis_os2.h" // Updated for CMSIS-RTOS v2
 
 // Threshold to ignore small joystick drift (Stick Drift)
 #define JOY_DEADZONE  0.15f
 
+// Snap-to-zero band after normalisation
+#define JOY_SNAP_ZERO     0.1f
+
+// One-pole IIR on the oversampled block means: y += (x - y) * alpha
+#define JOY_IIR_ALPHA     0.5f
+
+// ADC full scale (12-bit) and calibration limits, in raw counts
+#define JOY_ADC_MAX       4095
+#define JOY_REST_JITTER   24      // Auto-centre: blocks this close together count as "at rest"
+#define JOY_REST_BLOCKS   30      // ... for this many blocks in a row (300 ms)
+#define JOY_REST_RAIL     128     // A reading this close to either rail is a held (or unplugged) stick
+#define JOY_DEFAULT_SPAN  1024    // Travel assumed each way until the stick has been pushed further
+#define JOY_MIN_SPAN      256     // Floor on a side's travel, so a bad calibration can't blow up the scale
+#define JOY_SAVE_STEP     64      // Learned travel grown this much since the last save = save again
+
+//
+// Latest-Value Channel (Single Producer Seqlock)
+// InputTask is the only writer and runs above every reader, so a reader can
+// be interrupted by a publish but a publish is never interrupted by a reader.
+// Odd sequence = write in progress; a reader retries if the sequence moved.
+//
+static volatile uint32_t sample_seq = 0;
+static InputSample_t     sample_slot = {0.0f, 0.0f, 0, 0};
+
+//
+// Edge Event Ring (Single Producer / Single Consumer)
+// The producer (fire button EXTI, or code holding a critical section that masks
+// it) only writes 'event_head', the consumer only writes 'event_tail'.
+//
+static InputEvent_t      event_ring[INPUT_EVENT_QUEUE_LEN];
+static volatile uint8_t  event_head = 0;
+static volatile uint8_t  event_tail = 0;
+static volatile uint32_t events_dropped = 0;
+
+// Producer-side filter state (raw counts)
+static float filt_x = 0.0f;
+static float filt_y = 0.0f;
+static uint8_t filt_primed = 0;
+
+// Calibration state (InputTask only)
+static uint16_t rest_x = 0, rest_y = 0;
+static uint8_t  rest_blocks = 0;
+static uint16_t saved_span = 0;     // Sum of both axes' learned travel when last saved
+
+static uint16_t AbsDiff(uint16_t a, uint16_t b)
+{
+    return (a > b) ? (uint16_t)(a - b) : (uint16_t)(b - a);
+}
+
+static uint16_t ClampCounts(int32_t v)
+{
+    return (v < 0) ? 0 : (v > JOY_ADC_MAX) ? JOY_ADC_MAX : (uint16_t)v;
+}
+
+static uint16_t TotalSpan(void)
+{
+    return (uint16_t)((AppConfig.joy_max_x - AppConfig.joy_min_x) + (AppConfig.joy_max_y - AppConfig.joy_min_y));
+}
+
+//
+// Boot auto-centre: wherever the stick settles, not where mid-scale should be.
+// Blocks that stay within JOY_REST_JITTER of each other for JOY_REST_BLOCKS
+// in a row give the centre; the travel starts at JOY_DEFAULT_SPAN each way
+// and is learned from there. Saved at once, so later boots skip all this.
+//
+static void Calibrate_Centre(uint16_t raw_x, uint16_t raw_y)
+{
+    uint8_t on_rail = raw_x < JOY_REST_RAIL || raw_x > JOY_ADC_MAX - JOY_REST_RAIL ||
+                      raw_y < JOY_REST_RAIL || raw_y > JOY_ADC_MAX - JOY_REST_RAIL;
+
+    if (on_rail || AbsDiff(raw_x, rest_x) > JOY_REST_JITTER || AbsDiff(raw_y, rest_y) > JOY_REST_JITTER) {
+        rest_x = raw_x;
+        rest_y = raw_y;
+        rest_blocks = 0;
+        return;
+    }
+    if (++rest_blocks < JOY_REST_BLOCKS) return;
+
+    AppConfig.joy_center_x = rest_x;
+    AppConfig.joy_center_y = rest_y;
+    AppConfig.joy_min_x = ClampCounts((int32_t)rest_x - JOY_DEFAULT_SPAN);
+    AppConfig.joy_max_x = ClampCounts((int32_t)rest_x + JOY_DEFAULT_SPAN);
+    AppConfig.joy_min_y = ClampCounts((int32_t)rest_y - JOY_DEFAULT_SPAN);
+    AppConfig.joy_max_y = ClampCounts((int32_t)rest_y + JOY_DEFAULT_SPAN);
+    AppConfig.joy_calibrated = 1;
+    saved_span = TotalSpan();
+
+    // Kept from here on: LoadAppConfig restores it and later boots skip this
+    SaveAppConfig();
+    FlashStore_Commit();
+}
+
+//
+// Range: the furthest filtered reading each way becomes that side's full
+// deflection. Growth is queued for flash in JOY_SAVE_STEP steps and rides
+// the next commit (idle mirror or game over), so learning never erases.
+//
+static void Calibrate_Range(uint16_t x, uint16_t y)
+{
+    if (x < AppConfig.joy_min_x) AppConfig.joy_min_x = x;
+    if (x > AppConfig.joy_max_x) AppConfig.joy_max_x = x;
+    if (y < AppConfig.joy_min_y) AppConfig.joy_min_y = y;
+    if (y > AppConfig.joy_max_y) AppConfig.joy_max_y = y;
+
+    if (TotalSpan() >= saved_span + JOY_SAVE_STEP) {
+        saved_span = TotalSpan();
+        SaveAppConfig();
+    }
+}
+
+// Each side of the centre scales by its own travel
+static float Normalise(float v, uint16_t centre, uint16_t lo, uint16_t hi)
+{
+    float span = (v >= centre) ? (float)(hi - centre) : (float)(centre - lo);
+    if (span < JOY_MIN_SPAN) span = JOY_MIN_SPAN;
+    return (v - (float)centre) / span;
+}
+
 //
 // Initialize all Input Hardware
 //
 void Input_Init(void)
 {
+    // Latch the fire button level; from here on its EXTI edges feed the event ring
+    Button_Init();
+
     // Initialize the Analog hardware (Axes)
+    // Must run on InputTask: the DMA callbacks wake the thread that started it.
     ADC_Joystick_Init();
+}
 
-    // The Button is initialized inside ADC_Joystick_Init as a GPIO
-    // purely for convenience of grouping the wires, which is fine.
+//
+// Producer side: publish a complete sample
+//
+void Input_Publish(const InputSample_t *sample)
+{
+    sample_seq++;       // Odd: readers will retry
+    __DMB();
+    sample_slot = *sample;
+    __DMB();
+    sample_seq++;       // Even: sample is consistent again
 }
 
 //
-// Reads and Processes Player Input
+// Filters the newest ADC block, normalises it and publishes it
+// Called by InputTask each time the DMA half/full flag wakes it.
 //
-// Internal cache to remember the last known state
-// (Static ensures it persists between function calls)
-static PlayerInput_t cached_state = {0.0f, 0.0f, 0};
+void Input_Poll(void)
+{
+    InputSample_t sample;
+    uint16_t raw_x, raw_y;
 
-PlayerInput_t Input_ReadState(void)
+    // 1. Oversampled block mean from the ADC driver
+    ADC_ReadAveraged(&raw_x, &raw_y);
+
+    // 2. IIR smoothing (primed with the first block so there is no start-up ramp)
+    if (!filt_primed) {
+        filt_x = raw_x;
+        filt_y = raw_y;
+        filt_primed = 1;
+        saved_span = TotalSpan();
+    }
+    filt_x += ((float)raw_x - filt_x) * JOY_IIR_ALPHA;
+    filt_y += ((float)raw_y - filt_y) * JOY_IIR_ALPHA;
+
+    // 3. CALIBRATE: centre once (the stick rests at power-up), travel continuously
+    if (!AppConfig.joy_calibrated) {
+        Calibrate_Centre(raw_x, raw_y);
+    }
+    else {
+        Calibrate_Range((uint16_t)(filt_x + 0.5f), (uint16_t)(filt_y + 0.5f));
+    }
+
+    // 4. NORMALIZE against the calibration -> -1.0 .. 1.0
+    sample.x = Normalise(filt_x, AppConfig.joy_center_x, AppConfig.joy_min_x, AppConfig.joy_max_x);
+    sample.y = Normalise(filt_y, AppConfig.joy_center_y, AppConfig.joy_min_y, AppConfig.joy_max_y);
+
+    if (sample.x > 1.0f) sample.x = 1.0f; else if (sample.x < -1.0f) sample.x = -1.0f;
+    if (sample.y > 1.0f) sample.y = 1.0f; else if (sample.y < -1.0f) sample.y = -1.0f;
+
+    // Deadzone (Optional: Snaps small drift to 0.0)
+    if (fabsf(sample.x) < JOY_SNAP_ZERO) sample.x = 0.0f;
+    if (fabsf(sample.y) < JOY_SNAP_ZERO) sample.y = 0.0f;
+
+    // Fire edges arrive from the EXTI ISR; here we only recover a swallowed final edge
+    Button_Reconcile();
+    sample.buttons = Button_IsHeld();
+    sample.timestamp = Timing_Now();
+
+    Input_Publish(&sample);
+}
+
+//
+// Producer side: append an edge event (dropped and counted if the ring is full)
+//
+void Input_PushEvent(InputEventType_t type, uint32_t timestamp)
 {
-    uint32_t raw_msg;
-    osStatus_t status;
-    int data_found = 0;
-
-    // --- 1. DRAIN THE QUEUE (CMSIS-RTOS v2) ---
-    // Loop until the queue is empty. We only care about the very last packet.
-    // osMessageQueueGet replaces osMessageGet
-    while (1)
-    {
-        // Arguments: (Queue ID, buffer pointer, priority pointer, timeout in ticks)
-        status = osMessageQueueGet(xInputQueue, &raw_msg, NULL, 0);
+    uint8_t head = event_head;
+    uint8_t next = (head + 1) & (INPUT_EVENT_QUEUE_LEN - 1);
 
-        if (status == osOK) {
-            data_found = 1; // Mark that we got new data
-        } else {
-            break; // Queue is empty, stop looping
-        }
+    if (next == event_tail) {
+        events_dropped++;
+        return;
     }
 
-    // --- 2. UPDATE CACHE (If we got new data) ---
-    if (data_found)
+    event_ring[head].type = type;
+    event_ring[head].x = 0.0f; // Button edges carry no axis data
+    event_ring[head].y = 0.0f;
+    event_ring[head].timestamp = timestamp;
+    __DMB();
+    event_head = next;
+}
+
+uint32_t Input_GetDroppedEvents(void)
+{
+    return events_dropped;
+}
+
+//
+// Consumer side: copy out the newest sample without locks or kernel calls
+//
+void Input_GetLatest(InputSample_t *sample)
+{
+    uint32_t seq;
+
+    do {
+        seq = sample_seq;
+        __DMB();
+        *sample = sample_slot;
+        __DMB();
+    } while ((seq & 1u) || seq != sample_seq);
+}
+
+//
+// Builds the snapshot for one logic tick
+// Drains every edge queued since the last call and pairs it with the newest axes.
+//
+void Input_BeginTick(InputSnapshot_t *snapshot)
+{
+    InputSample_t sample;
+    uint8_t tail = event_tail;
+    uint8_t head = event_head;
+
+    __DMB();
+    snapshot->fire_presses = 0;
+    snapshot->fire_releases = 0;
+    snapshot->entity_cap = 0;
+    snapshot->spawn_interval = 0;
+
+    while (tail != head)
     {
-        // UNPACK: Mirroring the packing logic from InputTask
-        // [Btn (1 bit) | Unused | Y (12 bits) | X (12 bits)]
-        uint16_t raw_x = raw_msg & 0xFFF;
-        uint16_t raw_y = (raw_msg >> 12) & 0xFFF;
-        uint8_t  btn   = (raw_msg >> 24) & 1;
-
-        // NORMALIZE: Convert 0..4095 -> -1.0 .. 1.0
-        // (Assuming 2048 is center)
-        cached_state.x = ((float)raw_x - 2048.0f) / 2048.0f;
-        cached_state.y = ((float)raw_y - 2048.0f) / 2048.0f;
-
-        // Deadzone (Optional: Snaps small drift to 0.0)
-        if (fabsf(cached_state.x) < 0.1f) cached_state.x = 0.0f;
-        if (fabsf(cached_state.y) < 0.1f) cached_state.y = 0.0f;
-
-        cached_state.is_firing = btn;
+        if (event_ring[tail].type == EVENT_FIRE_PRESS) {
+            if (snapshot->fire_presses < 0xFF) snapshot->fire_presses++;
+        } else if (event_ring[tail].type == EVENT_FIRE_RELEASE) {
+            if (snapshot->fire_releases < 0xFF) snapshot->fire_releases++;
+        }
+        tail = (tail + 1) & (INPUT_EVENT_QUEUE_LEN - 1);
     }
+    __DMB();
+    event_tail = tail;
+
+    Input_GetLatest(&sample);
+    snapshot->x = sample.x;
+    snapshot->y = sample.y;
+    snapshot->fire_held = sample.buttons & 0x1;
+    snapshot->timestamp = sample.timestamp;
+}
+
+//
+// Reads and Processes Player Input
+// The channel always holds the newest sample, so a read between publishes
+// returns the previous position, which acts as a "Hold" (smooth movement).
+//
+PlayerInput_t Input_ReadState(void)
+{
+    InputSample_t sample;
+    PlayerInput_t state;
+
+    Input_GetLatest(&sample);
+
+    state.x = sample.x;
+    state.y = sample.y;
+    state.is_firing = sample.buttons & 0x1;
 
-    // --- 3. RETURN STATE ---
-    // If queue was empty, this returns the joystick position from the previous frame,
-    // which effectively acts as a "Hold" (perfect for smooth movement).
-    return cached_state;
+    return state;
 }
@@ -0,0 +1,98 @@
+/* oem/src/Engine/aiScheduler.c */
+#include "aiScheduler.h"
+#include "gameLogic.h"
+#include "timing.h"
+#include <string.h>
+
+static AiSchedMode_t  sched_mode = AI_SCHED_QUOTA;
+static AiSchedStats_t stats;
+static uint8_t        run_limit = AI_SCHED_NO_STOP;   // Replayed budget stop for the next run
+static uint8_t        last_stop = AI_SCHED_NO_STOP;
+
+void AiSched_SetMode(AiSchedMode_t mode)
+{
+    sched_mode = mode;
+}
+
+AiSchedMode_t AiSched_GetMode(void)
+{
+    return sched_mode;
+}
+
+// Cleared on read, so a tick without an AI run doesn't report the previous stop
+uint8_t AiSched_TakeBudgetStop(void)
+{
+    uint8_t stop = last_stop;
+    last_stop = AI_SCHED_NO_STOP;
+    return stop;
+}
+
+void AiSched_LimitNextRun(uint8_t thinks)
+{
+    run_limit = thinks;
+}
+
+void AiSched_GetStats(AiSchedStats_t *out)
+{
+    *out = stats;
+}
+
+void AiSched_ResetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void AiSched_Run(EntityStore_t *ents, uint8_t *cursor, uint32_t now_tick, AiThinkFn_t think)
+{
+    uint32_t start = Timing_Now();
+    uint32_t budget = Timing_UsToCycles(AI_BUDGET_US);
+    uint32_t quota = (ents->count + AI_TICK_INTERVAL - 1) / AI_TICK_INTERVAL;
+    uint32_t done = 0;
+    uint32_t rr_done = 0;
+    uint8_t  limit = run_limit;
+
+    run_limit = AI_SCHED_NO_STOP;
+    last_stop = AI_SCHED_NO_STOP;
+
+    // 1. Age guarantee: overdue entities think now, even past the budget
+    ENTITY_FOREACH(ents, i) {
+        uint32_t age = now_tick - ents->think_tick[i];
+        if (age < AI_MAX_THINK_AGE) continue;
+
+        think(i, age);
+        ents->think_tick[i] = now_tick;
+        stats.starved++;
+        done++;
+    }
+
+    // 2. Round robin from the cursor until the quota or the budget runs out
+    uint32_t scanned = 0;
+    for (; scanned < ENTITY_CAPACITY && done < quota; scanned++)
+    {
+        int i = (*cursor + scanned) % ENTITY_CAPACITY;
+        if (!Entity_IsActive(ents, i)) continue;
+
+        uint32_t age = now_tick - ents->think_tick[i];
+        if (age == 0) continue; // Already thought this tick (forced above)
+
+        // A replayed stop lands on the same entity the recorded budget stopped at
+        if (rr_done == limit) break;
+        if (sched_mode == AI_SCHED_BUDGET && (Timing_Now() - start) >= budget) {
+            stats.budget_stops++;
+            last_stop = (uint8_t)rr_done;
+            break;
+        }
+
+        think(i, age);
+        ents->think_tick[i] = now_tick;
+        done++;
+        rr_done++;
+    }
+    *cursor = (uint8_t)((*cursor + scanned) % ENTITY_CAPACITY);
+
+    uint32_t cycles = Timing_Now() - start;
+    stats.ticks++;
+    stats.thinks += done;
+    stats.last_cycles = cycles;
+    if (cycles > stats.max_cycles) stats.max_cycles = cycles;
+}
@@ -0,0 +1,198 @@
+/* oem/src/Engine/benchmark.c */
+#include "benchmark.h"
+#include "appConfig.h"
+#include "gameLogic.h"
+#include "flowfield.h"
+#include "raycaster.h"
+#include "display.h"
+#include "timing.h"
+#include <string.h>
+
+#if ENABLE_BENCHMARKS
+
+extern UART_HandleTypeDef huart2;
+
+static BenchResult_t results[BENCH_CASES];
+static BenchProjectileResult_t projectile_result;
+
+//
+// Fills the store with 'count' enemies spread over the open cells of the level.
+// Columns are taken from the one ahead of the player (who faces +x at the
+// start) and wrap around, so small counts land in view instead of behind.
+//
+static void PopulateEntities(int count)
+{
+    Entity_Clear(&Game.entities);
+    Spatial_Clear(&Game.grid);
+
+    int first_x = (int)Game.player.x + 1;
+    int placed = 0;
+    while (placed < count) {
+        int before = placed;
+        for (int col = 0; col < MAP_W && placed < count; col++) {
+            int x = (first_x + col) % MAP_W;
+            for (int y = 0; y < MAP_H && placed < count; y++) {
+                if (Game_Level()->map[x][y] != 0) continue;
+                if (Game_SpawnEnemy(x + 0.5f, y + 0.5f) == ENTITY_NONE) return;
+                placed++;
+            }
+        }
+        if (placed == before) return; // Level has no open cells
+    }
+}
+
+void Benchmark_RunEntityScaling(void)
+{
+    static const uint16_t counts[BENCH_CASES] = BENCH_ENTITY_COUNTS;
+
+    for (int c = 0; c < BENCH_CASES; c++)
+    {
+        results[c].entities = counts[c];
+        results[c].skipped = (counts[c] > ENTITY_CAPACITY);
+        results[c].ai_cycles = 0;
+        results[c].sprite_cycles = 0;
+        if (results[c].skipped) continue;
+
+        Game_Init(MODE_CLASSIC, 1);
+        Game.state = STATE_PLAYING;
+        PopulateEntities(counts[c]);
+
+        // Settle the flow field so the AI pass takes its normal (lookup) path
+        for (int i = 0; i < 8; i++) {
+            FlowField_Update(&Game.flow, Game_Level(), (int)Game.player.x, (int)Game.player.y);
+        }
+
+        // --- AI ---
+        uint32_t total = 0;
+        for (int i = 0; i < BENCH_ITERATIONS; i++) {
+            Game.player.health = 100; // Contact damage must not end the run
+            uint32_t t0 = Timing_Now();
+            Game_UpdateAI();
+            total += Timing_Now() - t0;
+        }
+        results[c].ai_cycles = total / BENCH_ITERATIONS;
+
+        // --- Sprites (walls drawn once to fill the Z-buffer) ---
+        Camera_t cam;
+        SpritePos_t sprites[ENTITY_CAPACITY];
+        Game_GetCamera(&cam);
+        for (int i = 0; i < ENTITY_CAPACITY; i++) sprites[i].active = 0;
+        ENTITY_FOREACH(&Game.entities, i) {
+            sprites[i].x = Game.entities.x[i];
+            sprites[i].y = Game.entities.y[i];
+            sprites[i].active = 1;
+        }
+
+        ClearScreen();
+        Render_3D_View(&cam);
+
+        total = 0;
+        for (int i = 0; i < BENCH_ITERATIONS; i++) {
+            uint32_t t0 = Timing_Now();
+            Render_Enemies(&cam, sprites, ENTITY_CAPACITY);
+            total += Timing_Now() - t0;
+        }
+        results[c].sprite_cycles = total / BENCH_ITERATIONS;
+    }
+
+    ClearScreen();
+}
+
+void Benchmark_RunProjectiles(void)
+{
+    Game_Init(MODE_CLASSIC, 1);
+    Game.state = STATE_PLAYING;
+
+    // Fill the pool with shots fanned out from the player so they spread across the view
+    for (int i = 0; i < PROJECTILE_CAPACITY; i++) {
+        float spread = (i - PROJECTILE_CAPACITY / 2) * 0.05f;
+        Projectile_Spawn(&Game.projectiles,
+                         Game.player.x + Game.player.dir_x * (1.0f + 0.2f * i),
+                         Game.player.y + Game.player.dir_y * (1.0f + 0.2f * i),
+                         Game.player.dir_x + Game.player.plane_x * spread,
+                         Game.player.dir_y + Game.player.plane_y * spread);
+    }
+
+    // Each run starts from the same full pool (the copy is outside the timed region)
+    ProjectilePool_t full = Game.projectiles;
+    const float far = 0.0f;     // Player out of reach: every shot takes the full path
+    uint8_t hits;
+    uint32_t total = 0;
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        Game.projectiles = full;
+        uint32_t t0 = Timing_Now();
+        Projectile_Step(&Game.projectiles, &far, &far, 1, &hits);
+        total += Timing_Now() - t0;
+    }
+    projectile_result.projectiles = full.count;
+    projectile_result.step_cycles = total / BENCH_ITERATIONS;
+
+    Camera_t cam;
+    SpritePos_t shots[PROJECTILE_CAPACITY];
+    Game_GetCamera(&cam);
+    for (int i = 0; i < PROJECTILE_CAPACITY; i++) {
+        shots[i].x = full.x[i];
+        shots[i].y = full.y[i];
+        shots[i].active = (full.active >> i) & 1;
+    }
+
+    ClearScreen();
+    Render_3D_View(&cam);
+
+    total = 0;
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        uint32_t t0 = Timing_Now();
+        Render_Projectiles(&cam, shots, PROJECTILE_CAPACITY);
+        total += Timing_Now() - t0;
+    }
+    projectile_result.render_cycles = total / BENCH_ITERATIONS;
+
+    ClearScreen();
+}
+
+const BenchProjectileResult_t* Benchmark_GetProjectileResult(void)
+{
+    return &projectile_result;
+}
+
+const BenchResult_t* Benchmark_GetResults(void)
+{
+    return results;
+}
+
+static int SendLine(const char *line)
+{
+    return HAL_UART_Transmit(&huart2, (const uint8_t*)line, (uint16_t)strlen(line), 100) == HAL_OK;
+}
+
+//
+// One line per case, cycles and microseconds at SystemCoreClock:
+//   bench entities=32 ai=12345c/146us sprite=23456c/279us
+//   bench projectiles=16 step=1234c/14us render=5678c/67us
+//
+int Benchmark_ExportUart(void)
+{
+    char line[96];
+
+    for (int c = 0; c < BENCH_CASES; c++) {
+        const BenchResult_t *r = &results[c];
+        if (r->skipped) {
+            snprintf(line, sizeof(line), "bench entities=%u skipped (ENTITY_CAPACITY %u)\r\n",
+                     r->entities, (unsigned)ENTITY_CAPACITY);
+        }
+        else {
+            snprintf(line, sizeof(line), "bench entities=%u ai=%luc/%luus sprite=%luc/%luus\r\n", r->entities,
+                     (unsigned long)r->ai_cycles, (unsigned long)Timing_CyclesToUs(r->ai_cycles),
+                     (unsigned long)r->sprite_cycles, (unsigned long)Timing_CyclesToUs(r->sprite_cycles));
+        }
+        if (!SendLine(line)) return 0;
+    }
+
+    const BenchProjectileResult_t *p = &projectile_result;
+    snprintf(line, sizeof(line), "bench projectiles=%u step=%luc/%luus render=%luc/%luus\r\n", p->projectiles,
+             (unsigned long)p->step_cycles, (unsigned long)Timing_CyclesToUs(p->step_cycles),
+             (unsigned long)p->render_cycles, (unsigned long)Timing_CyclesToUs(p->render_cycles));
+    return SendLine(line);
+}
+
+#endif /* ENABLE_BENCHMARKS */
@@ -0,0 +1,107 @@
+/* oem/src/Engine/collision.c */
+#include "collision.h"
+#include <math.h>
+
+// One bit per cell: bit y of occupancy[x] is set when map[x][y] is solid
+static uint16_t occupancy[MAP_W];
+
+void Collision_LoadLevel(const Level_t *level)
+{
+    for (int x = 0; x < MAP_W; x++) {
+        uint16_t column = 0;
+        for (int y = 0; y < MAP_H; y++) {
+            if (level->map[x][y] != 0) column |= (uint16_t)(1u << y);
+        }
+        occupancy[x] = column;
+    }
+}
+
+int Collision_IsSolid(int cell_x, int cell_y)
+{
+    if (cell_x < 0 || cell_x >= MAP_W || cell_y < 0 || cell_y >= MAP_H) return 1;
+    return (occupancy[cell_x] >> cell_y) & 1;
+}
+
+//
+// Pushes the circle out of every solid cell its bounding box touches.
+// Returns 1 if any cell was overlapping.
+//
+static int ResolveOverlaps(float *x, float *y, float radius)
+{
+    int touched = 0;
+
+    for (int pass = 0; pass < COLLISION_PASSES; pass++)
+    {
+        int x0 = (int)floorf(*x - radius), x1 = (int)floorf(*x + radius);
+        int y0 = (int)floorf(*y - radius), y1 = (int)floorf(*y + radius);
+        int moved = 0;
+
+        for (int cx = x0; cx <= x1; cx++) {
+            for (int cy = y0; cy <= y1; cy++) {
+                if (!Collision_IsSolid(cx, cy)) continue;
+
+                // Closest point of the cell box to the circle centre
+                float px = fminf(fmaxf(*x, (float)cx), (float)cx + 1.0f);
+                float py = fminf(fmaxf(*y, (float)cy), (float)cy + 1.0f);
+                float nx = *x - px;
+                float ny = *y - py;
+                float distSq = nx * nx + ny * ny;
+
+                if (distSq >= radius * radius) continue;
+
+                if (distSq > 1e-8f) {
+                    float dist = sqrtf(distSq);
+                    float push = radius - dist;
+                    *x += nx / dist * push;
+                    *y += ny / dist * push;
+                }
+                else {
+                    // Centre on the box edge: leave through the nearest face
+                    float left = *x - cx, right = cx + 1.0f - *x;
+                    float down = *y - cy, up = cy + 1.0f - *y;
+                    float m = fminf(fminf(left, right), fminf(down, up));
+                    if (m == left)       *x = cx - radius;
+                    else if (m == right) *x = cx + 1.0f + radius;
+                    else if (m == down)  *y = cy - radius;
+                    else                 *y = cy + 1.0f + radius;
+                }
+                moved = 1;
+            }
+        }
+
+        if (!moved) break;
+        touched = 1;
+    }
+
+    return touched;
+}
+
+int Collision_MoveCircle(float *x, float *y, float dx, float dy, float radius)
+{
+    float len = sqrtf(dx * dx + dy * dy);
+    if (len <= 0.0f) return 0;
+
+    // Sub-steps no longer than radius/2 keep the swept circle from skipping a cell;
+    // a move longer than the sub-step budget allows is shortened, never tunnelled
+    float max_len = COLLISION_MAX_SUBSTEPS * radius * 0.5f;
+    if (len > max_len) {
+        dx *= max_len / len;
+        dy *= max_len / len;
+        len = max_len;
+    }
+
+    int steps = (int)ceilf(len / (radius * 0.5f));
+    if (steps < 1) steps = 1;
+
+    float sx = dx / steps;
+    float sy = dy / steps;
+    int touched = 0;
+
+    for (int i = 0; i < steps; i++) {
+        *x += sx;
+        *y += sy;
+        touched |= ResolveOverlaps(x, y, radius);
+    }
+
+    return touched;
+}
@@ -0,0 +1,130 @@
+/* oem/src/Engine/effects.c */
+#include "effects.h"
+#include "particles.h"
+#include "display.h"
+#include "main.h"
+
+// Default overlay lifetimes in rendered frames (~33 ms each)
+static const uint8_t EffectFrames[EFFECT_TYPE_COUNT] = {
+    [EFFECT_MUZZLE_FLASH] = 1,
+    [EFFECT_HIT_MARKER]   = 4,
+    [EFFECT_SCREEN_SHAKE] = 6,
+    [EFFECT_DAMAGE_FLASH] = 2,
+    [EFFECT_BURST]        = 0,
+};
+
+static EffectCmd_t       effect_ring[EFFECT_QUEUE_LEN];
+static volatile uint8_t  effect_head = 0;
+static volatile uint8_t  effect_tail = 0;
+static volatile uint32_t effects_dropped = 0;
+static uint8_t           effects_muted = 0;     // Producer-only
+
+// Consumer-only state: frames left per overlay, and a frame counter for the shake sign
+static uint8_t  effect_frames_left[EFFECT_TYPE_COUNT];
+static uint32_t effect_frame = 0;
+
+//
+// Producer side: append one command (dropped and counted if the ring is full)
+//
+static void Push(const EffectCmd_t *cmd)
+{
+    uint8_t head = effect_head;
+    uint8_t next = (head + 1) & (EFFECT_QUEUE_LEN - 1);
+
+    if (effects_muted) return;
+    if (next == effect_tail) {
+        effects_dropped++;
+        return;
+    }
+
+    effect_ring[head] = *cmd;
+    __DMB();
+    effect_head = next;
+}
+
+void Effects_Trigger(EffectType_t type)
+{
+    EffectCmd_t cmd = { .type = type, .frames = EffectFrames[type] };
+    Push(&cmd);
+}
+
+void Effects_Burst(float x, float y, uint8_t count)
+{
+    EffectCmd_t cmd = { .type = EFFECT_BURST, .count = count, .x = x, .y = y };
+    Push(&cmd);
+}
+
+uint32_t Effects_GetDropped(void)
+{
+    return effects_dropped;
+}
+
+void Effects_SetMuted(uint8_t muted)
+{
+    effects_muted = muted;
+}
+
+//
+// Consumer side: the previous frame's overlays lose a frame, then every queued
+// command starts or extends its overlay. Drained on every screen so nothing
+// queued during a run pops up at the start of the next one.
+//
+void Effects_BeginFrame(void)
+{
+    effect_frame++;
+    for (int t = 0; t < EFFECT_TYPE_COUNT; t++) {
+        if (effect_frames_left[t]) effect_frames_left[t]--;
+    }
+
+    uint8_t tail = effect_tail;
+    uint8_t head = effect_head;
+    __DMB();
+
+    while (tail != head)
+    {
+        const EffectCmd_t *cmd = &effect_ring[tail];
+
+        if (cmd->type == EFFECT_BURST) {
+            Particles_Emit(cmd->x, cmd->y, cmd->count);
+        }
+        else if (cmd->type < EFFECT_TYPE_COUNT && cmd->frames > effect_frames_left[cmd->type]) {
+            effect_frames_left[cmd->type] = cmd->frames;
+        }
+        tail = (tail + 1) & (EFFECT_QUEUE_LEN - 1);
+    }
+    __DMB();
+    effect_tail = tail;
+}
+
+void Effects_ApplyCamera(Camera_t *cam)
+{
+    if (!effect_frames_left[EFFECT_SCREEN_SHAKE]) return;
+
+    // Alternate sides along the camera plane, fading out with the remaining frames
+    float amp = EFFECT_SHAKE_AMPLITUDE * effect_frames_left[EFFECT_SCREEN_SHAKE]
+              / EffectFrames[EFFECT_SCREEN_SHAKE];
+    if (effect_frame & 1) amp = -amp;
+
+    cam->x += cam->plane_x * amp;
+    cam->y += cam->plane_y * amp;
+}
+
+void Effects_Composite(void)
+{
+    if (effect_frames_left[EFFECT_MUZZLE_FLASH]) {
+        DrawVLine(62, 28, 36, 1);
+        DrawVLine(66, 28, 36, 1);
+    }
+
+    if (effect_frames_left[EFFECT_HIT_MARKER]) {
+        DrawLine(58, 27, 60, 29);
+        DrawLine(68, 27, 66, 29);
+        DrawLine(58, 37, 60, 35);
+        DrawLine(68, 37, 66, 35);
+    }
+
+    // Last: inverts everything drawn so far, HUD included
+    if (effect_frames_left[EFFECT_DAMAGE_FLASH]) {
+        InvertScreen();
+    }
+}
@@ -0,0 +1,41 @@
+/* oem/src/Engine/entity.c */
+#include "entity.h"
+#include <string.h>
+
+void Entity_Clear(EntityStore_t *store)
+{
+    memset(store, 0, sizeof(*store));
+}
+
+//
+// Takes the lowest free slot (first zero bit), so spawn order is deterministic
+//
+int Entity_Spawn(EntityStore_t *store, EntityType_t type, float x, float y, int16_t health)
+{
+    for (int w = 0; w < ENTITY_MASK_WORDS; w++)
+    {
+        uint32_t free_bits = ~store->active[w];
+        if (free_bits == 0) continue;
+
+        int idx = w * 32 + __builtin_ctz(free_bits);
+        if (idx >= ENTITY_CAPACITY) break;
+
+        store->x[idx] = x;
+        store->y[idx] = y;
+        store->health[idx] = health;
+        store->type[idx] = (uint8_t)type;
+        store->state[idx] = ENTITY_STATE_IDLE;
+        store->active[w] |= (1u << (idx & 31));
+        store->count++;
+        return idx;
+    }
+    return ENTITY_NONE;
+}
+
+void Entity_Kill(EntityStore_t *store, int idx)
+{
+    if (idx < 0 || idx >= ENTITY_CAPACITY || !Entity_IsActive(store, idx)) return;
+
+    store->active[idx >> 5] &= ~(1u << (idx & 31));
+    store->count--;
+}
@@ -0,0 +1,161 @@
+/* oem/src/Engine/flowfield.c */
+#include "flowfield.h"
+#include <string.h>
+
+#define CELL(x, y)  ((uint8_t)((x) * MAP_H + (y)))
+#define CELL_X(c)   ((c) / MAP_H)
+#define CELL_Y(c)   ((c) % MAP_H)
+
+// Orthogonal neighbours drive the BFS; diagonals are only used when picking the next step
+static const int8_t NEIGHBOUR_DX[8] = { 1, -1,  0,  0,  1,  1, -1, -1 };
+static const int8_t NEIGHBOUR_DY[8] = { 0,  0,  1, -1,  1, -1,  1, -1 };
+
+static int IsOpen(const Level_t *level, int x, int y)
+{
+    if (x < 0 || x >= MAP_W || y < 0 || y >= MAP_H) return 0;
+    return level->map[x][y] == 0;
+}
+
+void FlowField_Reset(FlowState_t *flow)
+{
+    flow->fields[0].valid = 0;
+    flow->fields[1].valid = 0;
+    flow->active = 0;
+    flow->build_pending = 0;
+    flow->want_x = 0xFF;
+    flow->want_y = 0xFF;
+    flow->want_bx = 0xFF;
+    flow->want_by = 0xFF;
+}
+
+static void Seed(FlowState_t *flow, FlowField_t *building, const Level_t *level, int x, int y)
+{
+    if (!IsOpen(level, x, y) || building->dist[CELL(x, y)] == 0) return;
+
+    building->dist[CELL(x, y)] = 0;
+    flow->queue[flow->q_tail++] = CELL(x, y);
+}
+
+static void BeginBuild(FlowState_t *flow, const Level_t *level, int tx, int ty, int bx, int by)
+{
+    FlowField_t *building = &flow->fields[flow->active ^ 1];
+
+    memset(building->dist, FLOW_UNREACHABLE, sizeof(building->dist));
+    memset(building->next, FLOW_NO_STEP, sizeof(building->next));
+    building->target_x = (uint8_t)tx;
+    building->target_y = (uint8_t)ty;
+    building->target_bx = (uint8_t)bx;
+    building->target_by = (uint8_t)by;
+    building->valid = 0;
+
+    flow->q_head = flow->q_tail = 0;
+    Seed(flow, building, level, tx, ty);
+    Seed(flow, building, level, bx, by);
+
+    flow->want_x = (uint8_t)tx;
+    flow->want_y = (uint8_t)ty;
+    flow->want_bx = (uint8_t)bx;
+    flow->want_by = (uint8_t)by;
+    flow->build_pending = 1;
+}
+
+//
+// Every reached cell points at its lowest-distance neighbour (by direction,
+// so the stored value never depends on the map size). Diagonals are
+// allowed only when both orthogonal cells are open, so enemies never clip corners.
+//
+static void ResolveSteps(FlowField_t *building, const Level_t *level)
+{
+    for (int c = 0; c < FLOW_CELLS; c++)
+    {
+        uint8_t d = building->dist[c];
+        if (d == FLOW_UNREACHABLE || d == 0) continue;
+
+        int x = CELL_X(c), y = CELL_Y(c);
+        uint8_t best = d;
+        uint8_t best_dir = FLOW_NO_STEP;
+
+        for (int n = 0; n < 8; n++) {
+            int nx = x + NEIGHBOUR_DX[n];
+            int ny = y + NEIGHBOUR_DY[n];
+            if (!IsOpen(level, nx, ny)) continue;
+            if (n >= 4 && (!IsOpen(level, nx, y) || !IsOpen(level, x, ny))) continue;
+
+            uint8_t nd = building->dist[CELL(nx, ny)];
+            if (nd < best) {
+                best = nd;
+                best_dir = (uint8_t)n;
+            }
+        }
+        building->next[c] = best_dir;
+    }
+}
+
+void FlowField_Update(FlowState_t *flow, const Level_t *level, int player_x, int player_y)
+{
+    FlowField_UpdatePair(flow, level, player_x, player_y, player_x, player_y);
+}
+
+void FlowField_UpdatePair(FlowState_t *flow, const Level_t *level, int ax, int ay, int bx, int by)
+{
+    if (ax != flow->want_x || ay != flow->want_y || bx != flow->want_bx || by != flow->want_by) {
+        BeginBuild(flow, level, ax, ay, bx, by);
+    }
+    if (!flow->build_pending) return;
+
+    FlowField_t *building = &flow->fields[flow->active ^ 1];
+
+    for (int budget = FLOW_CELLS_PER_TICK; budget > 0 && flow->q_head < flow->q_tail; budget--)
+    {
+        uint8_t c = flow->queue[flow->q_head++];
+        int x = CELL_X(c), y = CELL_Y(c);
+        uint8_t nd = building->dist[c] + 1;
+
+        for (int n = 0; n < 4; n++) {
+            int nx = x + NEIGHBOUR_DX[n];
+            int ny = y + NEIGHBOUR_DY[n];
+            if (!IsOpen(level, nx, ny)) continue;
+
+            uint8_t nc = CELL(nx, ny);
+            if (building->dist[nc] != FLOW_UNREACHABLE) continue;
+            building->dist[nc] = nd;
+            flow->queue[flow->q_tail++] = nc;
+        }
+    }
+
+    if (flow->q_head == flow->q_tail) {
+        ResolveSteps(building, level);
+        building->valid = 1;
+        flow->build_pending = 0;
+        flow->active ^= 1;
+    }
+}
+
+int FlowField_NextCell(const FlowState_t *flow, int cell_x, int cell_y, int *next_x, int *next_y)
+{
+    const FlowField_t *active = &flow->fields[flow->active];
+
+    if (!active->valid) return 0;
+    if (cell_x < 0 || cell_x >= MAP_W || cell_y < 0 || cell_y >= MAP_H) return 0;
+
+    uint8_t dir = active->next[CELL(cell_x, cell_y)];
+    if (dir == FLOW_NO_STEP) return 0;
+
+    *next_x = cell_x + NEIGHBOUR_DX[dir];
+    *next_y = cell_y + NEIGHBOUR_DY[dir];
+    return 1;
+}
+
+uint8_t FlowField_Distance(const FlowState_t *flow, int cell_x, int cell_y)
+{
+    const FlowField_t *active = &flow->fields[flow->active];
+
+    if (!active->valid) return FLOW_UNREACHABLE;
+    if (cell_x < 0 || cell_x >= MAP_W || cell_y < 0 || cell_y >= MAP_H) return FLOW_UNREACHABLE;
+    return active->dist[CELL(cell_x, cell_y)];
+}
+
+const FlowField_t* FlowField_Get(const FlowState_t *flow)
+{
+    return &flow->fields[flow->active];
+}
@@ -0,0 +1,101 @@
+/* oem/src/Engine/governor.c */
+#include "governor.h"
+#include "entity.h"
+#include "timing.h"
+
+#if GOV_MAX_ENEMIES < ENTITY_CAPACITY
+#define GOV_CAP_CEILING     GOV_MAX_ENEMIES
+#else
+#define GOV_CAP_CEILING     ENTITY_CAPACITY
+#endif
+
+// Each average has a single writer (its task); 32-bit reads elsewhere are atomic
+static volatile uint32_t render_avg_us = 0;
+static volatile uint32_t logic_avg_us = 0;
+
+static uint8_t  entity_cap = GOV_MIN_ENEMIES;
+static uint8_t  spawn_interval = GOV_MAX_SPAWN_INTERVAL / 2;
+static uint8_t  eval_counter = 0;
+static uint8_t  calm_evals = 0;
+static GovernorStats_t stats;
+
+static uint32_t Ewma(uint32_t avg, uint32_t sample)
+{
+    if (avg == 0) return sample;
+    return avg - (avg >> GOV_EWMA_SHIFT) + (sample >> GOV_EWMA_SHIFT);
+}
+
+void Governor_Reset(void)
+{
+    entity_cap = GOV_MIN_ENEMIES;
+    spawn_interval = GOV_MAX_SPAWN_INTERVAL / 2;
+    eval_counter = 0;
+    calm_evals = 0;
+    stats.last_decision = GOV_HOLD;
+}
+
+void Governor_ReportRender(uint32_t cycles)
+{
+    render_avg_us = Ewma(render_avg_us, Timing_CyclesToUs(cycles));
+}
+
+void Governor_ReportLogic(uint32_t cycles)
+{
+    logic_avg_us = Ewma(logic_avg_us, Timing_CyclesToUs(cycles));
+}
+
+void Governor_Update(void)
+{
+    if (++eval_counter < GOV_EVAL_TICKS) return;
+    eval_counter = 0;
+
+    uint32_t r = render_avg_us;
+    uint32_t l = logic_avg_us;
+    GovDecision_t decision = GOV_HOLD;
+
+    if (r > GOV_RENDER_TARGET_US || l > GOV_LOGIC_TARGET_US) {
+        // Shed load straight away
+        calm_evals = 0;
+        if (entity_cap > GOV_MIN_ENEMIES) entity_cap--;
+        if (spawn_interval < GOV_MAX_SPAWN_INTERVAL) spawn_interval++;
+        decision = (r > GOV_RENDER_TARGET_US) ? GOV_LOWERED_RENDER : GOV_LOWERED_LOGIC;
+        stats.lowers++;
+    }
+    else if (r * 100 < GOV_RENDER_TARGET_US * GOV_HEADROOM_PCT &&
+             l * 100 < GOV_LOGIC_TARGET_US * GOV_HEADROOM_PCT) {
+        // Add load slowly: only after sustained headroom
+        if (++calm_evals >= GOV_RAISE_EVALS) {
+            calm_evals = 0;
+            if (entity_cap < GOV_CAP_CEILING || spawn_interval > GOV_MIN_SPAWN_INTERVAL) {
+                if (entity_cap < GOV_CAP_CEILING) entity_cap++;
+                if (spawn_interval > GOV_MIN_SPAWN_INTERVAL) spawn_interval--;
+                decision = GOV_RAISED;
+                stats.raises++;
+            }
+        }
+    }
+    else {
+        calm_evals = 0;
+    }
+
+    stats.last_decision = (uint8_t)decision;
+}
+
+uint8_t Governor_EntityCap(void)
+{
+    return entity_cap;
+}
+
+uint8_t Governor_SpawnInterval(void)
+{
+    return spawn_interval;
+}
+
+void Governor_GetStats(GovernorStats_t *out)
+{
+    *out = stats;
+    out->render_avg_us = render_avg_us;
+    out->logic_avg_us = logic_avg_us;
+    out->entity_cap = entity_cap;
+    out->spawn_interval = spawn_interval;
+}
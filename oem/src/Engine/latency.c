@@ -0,0 +1,74 @@
+/* oem/src/Engine/latency.c */
+#include "latency.h"
+#include "timing.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+static uint32_t histogram[LATENCY_BUCKETS];
+static uint32_t sample_count = 0;
+static uint32_t min_us = 0xFFFFFFFF;
+static uint32_t max_us = 0;
+static uint64_t sum_us = 0;
+
+// Timestamp of the last sample already measured (later frames showing it are not "first")
+static uint32_t last_recorded = 0;
+
+void Latency_Reset(void)
+{
+    taskENTER_CRITICAL();
+    for (int i = 0; i < LATENCY_BUCKETS; i++) histogram[i] = 0;
+    sample_count = 0;
+    min_us = 0xFFFFFFFF;
+    max_us = 0;
+    sum_us = 0;
+    taskEXIT_CRITICAL();
+}
+
+//
+// Records one frame: input_timestamp is the sample the frame reflects,
+// flush_done is taken right after OLED_Update returns
+//
+void Latency_RecordFrame(uint32_t input_timestamp, uint32_t flush_done)
+{
+    if (input_timestamp == 0 || input_timestamp == last_recorded) return;
+    last_recorded = input_timestamp;
+
+    uint32_t us = Timing_CyclesToUs(flush_done - input_timestamp);
+    uint32_t bucket = us / LATENCY_BUCKET_US;
+    if (bucket >= LATENCY_BUCKETS) bucket = LATENCY_BUCKETS - 1;
+
+    taskENTER_CRITICAL();
+    histogram[bucket]++;
+    sample_count++;
+    sum_us += us;
+    if (us < min_us) min_us = us;
+    if (us > max_us) max_us = us;
+    taskEXIT_CRITICAL();
+}
+
+void Latency_GetStats(LatencyStats_t *stats)
+{
+    taskENTER_CRITICAL();
+    stats->count = sample_count;
+    stats->min_us = sample_count ? min_us : 0;
+    stats->max_us = max_us;
+    stats->mean_us = sample_count ? (uint32_t)(sum_us / sample_count) : 0;
+
+    // Walk the histogram until 99% of the samples are covered
+    uint32_t target = sample_count - sample_count / 100;
+    uint32_t seen = 0;
+    stats->p99_us = 0;
+    for (int i = 0; i < LATENCY_BUCKETS && sample_count; i++) {
+        seen += histogram[i];
+        if (seen >= target) {
+            stats->p99_us = (i + 1) * LATENCY_BUCKET_US;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+const uint32_t* Latency_GetHistogram(void)
+{
+    return histogram;
+}
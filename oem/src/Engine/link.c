@@ -0,0 +1,394 @@
+/* oem/src/Engine/link.c */
+#include "link.h"
+#include "crc32.h"
+#include "timing.h"
+#include "version.h"
+#include <string.h>
+
+//
+// Frame: SYNC, type, body length, body, CRC-16 (low half of the CRC-32 of
+// type, length and body). All fields little endian.
+//   HELLO: version, build id (4), nonce (4), seed (4), mode, flags
+//   INPUT: ack (2), first tick (2), count, count x {x, y, flags, governor}
+//   HASH : tick (4), Game_StateHash() after that tick (4)
+// Tick numbers in INPUT are the low 16 bits, widened against what we expect.
+//
+#define LINK_SYNC           0xA5
+#define LINK_PKT_HELLO      1
+#define LINK_PKT_INPUT      2
+#define LINK_PKT_HASH       3
+#define LINK_FRAME_OVERHEAD 5
+#define LINK_MAX_BODY       (LINK_RX_BUFFER - LINK_FRAME_OVERHEAD)
+#define LINK_HELLO_SEEN     0x01    // HELLO flag: the sender has heard the receiver
+#define LINK_HELLO_RUNNING  0x02    // HELLO flag: the sender has started (never answered)
+#define LINK_MASK           (LINK_WINDOW - 1)
+#define LINK_BUILD_ID       (((uint32_t)MAJOR_VERSION << 16) | ((uint32_t)MINOR_VERSION << 8) | PATCH_VERSION)
+
+// ==================== Input Packing ====================
+
+// Same quantisation as a replay stream (replay.c), so a link run and a replay
+// of one feed the simulation identical values
+static int8_t QuantAxis(float v)
+{
+    int q = (int)(v * 127.0f + (v >= 0.0f ? 0.5f : -0.5f));
+    if (q > 127) q = 127;
+    if (q < -127) q = -127;
+    return (int8_t)q;
+}
+
+static void Pack(const InputSnapshot_t *in, uint8_t presses, uint8_t releases, uint8_t *out)
+{
+    if (presses > 3) presses = 3;
+    if (releases > 3) releases = 3;
+    uint8_t cap = in->entity_cap > 31 ? 31 : in->entity_cap;
+    uint8_t interval = in->spawn_interval > 7 ? 7 : in->spawn_interval;
+
+    out[0] = (uint8_t)QuantAxis(in->x);
+    out[1] = (uint8_t)QuantAxis(in->y);
+    out[2] = (in->fire_held & 0x1) | (presses << 1) | (releases << 3);
+    out[3] = cap | (interval << 5);
+}
+
+static void Unpack(const uint8_t *in, uint32_t stamp, InputSnapshot_t *out)
+{
+    out->x = (int8_t)in[0] / 127.0f;
+    out->y = (int8_t)in[1] / 127.0f;
+    out->fire_held = in[2] & 0x1;
+    out->fire_presses = (in[2] >> 1) & 0x3;
+    out->fire_releases = (in[2] >> 3) & 0x3;
+    out->entity_cap = in[3] & 0x1F;
+    out->spawn_interval = in[3] >> 5;
+    out->timestamp = stamp;
+}
+
+// ==================== Framing ====================
+
+static void Put16(uint8_t *p, uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static void Put32(uint8_t *p, uint32_t v) { Put16(p, v); Put16(p + 2, v >> 16); }
+static uint16_t Get16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t Get32(const uint8_t *p) { return Get16(p) | ((uint32_t)Get16(p + 2) << 16); }
+
+// Full tick number nearest to 'near' whose low 16 bits are 'low'
+static uint32_t Widen(uint16_t low, uint32_t near)
+{
+    return near + (int16_t)(uint16_t)(low - (uint16_t)near);
+}
+
+static void SendFrame(LinkSession_t *s, uint8_t type, const uint8_t *body, uint8_t len)
+{
+    uint8_t frame[LINK_RX_BUFFER];
+
+    frame[0] = LINK_SYNC;
+    frame[1] = type;
+    frame[2] = len;
+    memcpy(&frame[3], body, len);
+    Put16(&frame[3 + len], Crc32(&frame[1], 2 + len));
+
+    uint16_t total = LINK_FRAME_OVERHEAD + len;
+    s->last_tx = Timing_Now();
+    if (!s->io->send(s->io->ctx, frame, total)) {
+        s->stats.tx_full++;
+        return;
+    }
+    s->stats.tx_bytes += total;
+    s->stats.tx_packets++;
+}
+
+static void SendHello(LinkSession_t *s)
+{
+    uint8_t body[15];
+
+    body[0] = LINK_PROTOCOL_VERSION;
+    Put32(&body[1], LINK_BUILD_ID);
+    Put32(&body[5], s->nonce);
+    Put32(&body[9], s->seed);
+    body[13] = s->mode;
+    body[14] = (s->peer_heard ? LINK_HELLO_SEEN : 0) | (s->state == LINK_RUNNING ? LINK_HELLO_RUNNING : 0);
+    SendFrame(s, LINK_PKT_HELLO, body, sizeof(body));
+    s->last_hello = Timing_Now();
+}
+
+//
+// Every local input the peer hasn't acknowledged (oldest first, up to
+// LINK_MAX_RESEND), plus our own ack. Unless forced (keepalive), skipped
+// when there is neither news nor anything outstanding.
+//
+static void SendInputs(LinkSession_t *s, int force)
+{
+    uint8_t body[5 + 4 * LINK_MAX_RESEND];
+    uint32_t first = s->peer_acked;
+    uint32_t count = s->local_next - first;
+
+    if (count > LINK_MAX_RESEND) count = LINK_MAX_RESEND;
+    if (count == 0 && s->ack_sent == s->remote_next && !force) return;
+
+    Put16(&body[0], s->remote_next);
+    Put16(&body[2], first);
+    body[4] = (uint8_t)count;
+
+    uint32_t now = Timing_Now();
+    for (uint32_t k = 0; k < count; k++) {
+        uint32_t t = first + k;
+        memcpy(&body[5 + 4 * k], s->local_in[t & LINK_MASK], 4);
+        if (t < s->sent_next) s->stats.resent_inputs++;
+        else s->sent_at[t & LINK_MASK] = now;
+    }
+    if (first + count > s->sent_next) s->sent_next = first + count;
+    s->ack_sent = s->remote_next;
+
+    SendFrame(s, LINK_PKT_INPUT, body, (uint8_t)(5 + 4 * count));
+}
+
+// ==================== Receive ====================
+
+static void BeginRun(LinkSession_t *s)
+{
+    s->state = LINK_RUNNING;
+
+    // Ticks below the delay run on neutral inputs on both boards
+    memset(s->local_in, 0, sizeof(s->local_in));
+    memset(s->remote_in, 0, sizeof(s->remote_in));
+    memset(s->local_stamp, 0, sizeof(s->local_stamp));
+    s->run_tick = 0;
+    s->local_next = LINK_INPUT_DELAY;
+    s->remote_next = LINK_INPUT_DELAY;
+    s->peer_acked = LINK_INPUT_DELAY;
+    s->sent_next = LINK_INPUT_DELAY;
+    s->ack_sent = LINK_INPUT_DELAY;
+    s->carry_presses = 0;
+    s->carry_releases = 0;
+    s->local_hash_tick = 0;
+    s->peer_hash_tick = 0;
+}
+
+static void OnHello(LinkSession_t *s, const uint8_t *body, uint8_t len)
+{
+    if (len != 15 || body[0] != LINK_PROTOCOL_VERSION || Get32(&body[1]) != LINK_BUILD_ID) return;
+
+    if (s->state == LINK_RUNNING) {
+        // A waiting peer missed the HELLO that started us
+        if (!(body[14] & LINK_HELLO_RUNNING)) SendHello(s);
+        return;
+    }
+    if (s->state != LINK_WAITING) return;
+
+    uint32_t nonce = Get32(&body[5]);
+    if (nonce == s->nonce) {
+        // Same draw on both boards: pick again, the next HELLO settles it
+        s->nonce = s->nonce * 1664525u + 1013904223u;
+        s->peer_heard = 0;
+        return;
+    }
+
+    s->peer_nonce = nonce;
+    s->peer_heard = 1;
+    if (body[14] & LINK_HELLO_SEEN) s->peer_heard_us = 1;
+
+    // Higher nonce is side 0 and owns the run parameters
+    s->side = (s->nonce > s->peer_nonce) ? 0 : 1;
+    if (s->side == 1) {
+        s->seed = Get32(&body[9]);
+        s->mode = body[13];
+    }
+
+    SendHello(s);
+    if (s->peer_heard_us) BeginRun(s);
+}
+
+static void OnInput(LinkSession_t *s, const uint8_t *body, uint8_t len)
+{
+    if (s->state != LINK_RUNNING || len < 5) return;
+
+    uint8_t count = body[4];
+    if (len != 5 + 4 * count) return;
+
+    // Ack: everything below it reached the peer
+    uint32_t ack = Widen(Get16(&body[0]), s->peer_acked);
+    if ((int32_t)(ack - s->peer_acked) > 0 && (int32_t)(ack - s->sent_next) <= 0) {
+        s->peer_acked = ack;
+        uint32_t rtt = Timing_CyclesToUs(Timing_Now() - s->sent_at[(ack - 1) & LINK_MASK]);
+        s->stats.rtt_us = rtt;
+        if (rtt > s->stats.rtt_max_us) s->stats.rtt_max_us = rtt;
+    }
+
+    // Inputs: take only the next one we lack, in order; repeats are dropped
+    uint32_t first = Widen(Get16(&body[2]), s->remote_next);
+    for (uint8_t k = 0; k < count; k++) {
+        uint32_t t = first + k;
+        if (t != s->remote_next) continue;
+        if (s->remote_next - s->run_tick >= LINK_WINDOW) break;
+
+        memcpy(s->remote_in[t & LINK_MASK], &body[5 + 4 * k], 4);
+        s->remote_next++;
+    }
+}
+
+static void CompareHashes(LinkSession_t *s)
+{
+    if (s->local_hash_tick == 0 || s->local_hash_tick != s->peer_hash_tick) return;
+
+    s->stats.hash_checks++;
+    if (s->local_hash != s->peer_hash) {
+        s->stats.desync_tick = s->local_hash_tick;
+        s->state = LINK_DESYNC;
+    }
+    s->peer_hash_tick = 0;
+}
+
+static void OnHash(LinkSession_t *s, const uint8_t *body, uint8_t len)
+{
+    if (s->state != LINK_RUNNING || len != 8) return;
+
+    s->peer_hash_tick = Get32(&body[0]);
+    s->peer_hash = Get32(&body[4]);
+    CompareHashes(s);
+}
+
+//
+// Pulls every complete frame out of the assembly buffer. Anything that isn't
+// a frame with a good CRC is skipped one byte at a time until a SYNC lines up.
+//
+static void ParseFrames(LinkSession_t *s)
+{
+    while (s->rx_len > 0)
+    {
+        uint8_t skip = 0;
+
+        if (s->rx[0] != LINK_SYNC) {
+            skip = 1;
+        }
+        else if (s->rx_len < 3) {
+            return;
+        }
+        else if (s->rx[2] > LINK_MAX_BODY) {
+            skip = 1;
+            s->stats.crc_errors++;
+        }
+        else {
+            uint8_t len = s->rx[2];
+            uint8_t total = LINK_FRAME_OVERHEAD + len;
+            if (s->rx_len < total) return;
+
+            if (Get16(&s->rx[3 + len]) != (uint16_t)Crc32(&s->rx[1], 2 + len)) {
+                skip = 1;
+                s->stats.crc_errors++;
+            }
+            else {
+                const uint8_t *body = &s->rx[3];
+                s->last_rx = Timing_Now();
+
+                if (s->rx[1] == LINK_PKT_HELLO)      OnHello(s, body, len);
+                else if (s->rx[1] == LINK_PKT_INPUT) OnInput(s, body, len);
+                else if (s->rx[1] == LINK_PKT_HASH)  OnHash(s, body, len);
+                skip = total;
+            }
+        }
+
+        memmove(s->rx, &s->rx[skip], s->rx_len - skip);
+        s->rx_len -= skip;
+    }
+}
+
+// ==================== Session ====================
+
+void Link_Start(LinkSession_t *s, const LinkTransport_t *io, GameMode_t mode, uint32_t seed)
+{
+    memset(s, 0, sizeof(*s));
+    s->io = io;
+    s->state = LINK_WAITING;
+    s->mode = (uint8_t)mode;
+    s->seed = seed;
+    s->nonce = seed ^ Timing_Now() ^ 0x9E3779B9u;
+    s->last_rx = Timing_Now();
+    SendHello(s);
+}
+
+void Link_Stop(LinkSession_t *s)
+{
+    s->state = LINK_OFF;
+}
+
+LinkState_t Link_Service(LinkSession_t *s)
+{
+    if (s->state == LINK_OFF) return s->state;
+
+    uint16_t n;
+    while ((n = s->io->recv(s->io->ctx, &s->rx[s->rx_len], LINK_RX_BUFFER - s->rx_len)) > 0) {
+        s->rx_len += n;
+        s->stats.rx_bytes += n;
+        ParseFrames(s);
+    }
+
+    uint32_t now = Timing_Now();
+    if (s->state == LINK_WAITING) {
+        if (now - s->last_hello >= Timing_UsToCycles(LINK_HELLO_INTERVAL_MS * 1000u)) SendHello(s);
+    }
+    else if (s->state == LINK_RUNNING) {
+        if (now - s->last_rx >= Timing_UsToCycles(LINK_TIMEOUT_MS * 1000u)) s->state = LINK_LOST;
+        else if (now - s->last_tx >= Timing_UsToCycles(LINK_KEEPALIVE_MS * 1000u)) SendInputs(s, 1);
+    }
+    return s->state;
+}
+
+int Link_NextTick(LinkSession_t *s, const InputSnapshot_t *local, InputSnapshot_t *p0, InputSnapshot_t *p1)
+{
+    if (s->state != LINK_RUNNING) return 0;
+
+    // One local input per tick, LINK_INPUT_DELAY ahead. While stalled the slot
+    // is already filled: keep the fire edges for the next one.
+    uint8_t presses = s->carry_presses + local->fire_presses;
+    uint8_t releases = s->carry_releases + local->fire_releases;
+    if (s->local_next <= s->run_tick + LINK_INPUT_DELAY && s->local_next - s->peer_acked < LINK_WINDOW) {
+        uint32_t slot = s->local_next & LINK_MASK;
+        Pack(local, presses, releases, s->local_in[slot]);
+        s->local_stamp[slot] = local->timestamp;
+        s->local_next++;
+        presses = releases = 0;
+    }
+    s->carry_presses = presses;
+    s->carry_releases = releases;
+
+    SendInputs(s, 0);
+
+    if (s->remote_next == s->run_tick) {
+        s->stats.stall_polls++;
+        return 0;
+    }
+
+    uint32_t slot = s->run_tick & LINK_MASK;
+    InputSnapshot_t mine, theirs;
+    Unpack(s->local_in[slot], s->local_stamp[slot], &mine);
+    Unpack(s->remote_in[slot], 0, &theirs);
+    *p0 = s->side ? theirs : mine;
+    *p1 = s->side ? mine : theirs;
+
+    s->run_tick++;
+    s->stats.ticks++;
+    return 1;
+}
+
+void Link_EndTick(LinkSession_t *s)
+{
+    if (s->state != LINK_RUNNING || s->run_tick % LINK_HASH_INTERVAL) return;
+
+    uint8_t body[8];
+    s->local_hash_tick = s->run_tick;
+    s->local_hash = Game_StateHash();
+    Put32(&body[0], s->local_hash_tick);
+    Put32(&body[4], s->local_hash);
+    SendFrame(s, LINK_PKT_HASH, body, sizeof(body));
+    CompareHashes(s);
+}
+
+void Link_GetStats(const LinkSession_t *s, LinkStats_t *stats)
+{
+    *stats = s->stats;
+
+    if (stats->ticks) {
+        stats->tx_bytes_per_tick = stats->tx_bytes / stats->ticks;
+        stats->added_latency_ms = LINK_INPUT_DELAY * LOGIC_TICK_MS + stats->stall_polls * LOGIC_TICK_MS / stats->ticks;
+    }
+    else {
+        stats->added_latency_ms = LINK_INPUT_DELAY * LOGIC_TICK_MS;
+    }
+}
@@ -0,0 +1,98 @@
+/* oem/src/Engine/particles.c */
+#include "particles.h"
+#include "collision.h"
+#include "rng.h"
+
+#if PARTICLE_CAPACITY > 32
+#error "Particle pool mask is a single 32-bit word"
+#endif
+
+static ParticlePool_t pool = { .rng = 0x2545F491u };
+
+static int16_t ToFixed(float v)
+{
+    return (int16_t)(v * PARTICLE_ONE);
+}
+
+// Signed value in [-range, range], Q8.8
+static int16_t Spread(int32_t range)
+{
+    return (int16_t)((int32_t)Rng_Range(&pool.rng, (uint32_t)(2 * range + 1)) - range);
+}
+
+void Particles_Emit(float x, float y, int count)
+{
+    int16_t fx = ToFixed(x), fy = ToFixed(y);
+
+    for (int n = 0; n < count; n++)
+    {
+        uint32_t free_bits = ~pool.active;
+#if PARTICLE_CAPACITY < 32
+        free_bits &= (1u << PARTICLE_CAPACITY) - 1;
+#endif
+        if (free_bits == 0) {
+            pool.dropped += (uint8_t)(count - n);
+            return;
+        }
+
+        int i = __builtin_ctz(free_bits);
+        pool.x[i] = fx;
+        pool.y[i] = fy;
+        pool.z[i] = PARTICLE_ONE / 2;
+        pool.vx[i] = Spread(PARTICLE_ONE);              // Up to 1 unit/s sideways
+        pool.vy[i] = Spread(PARTICLE_ONE);
+        pool.vz[i] = (int16_t)(PARTICLE_ONE / 2 + Rng_Range(&pool.rng, PARTICLE_ONE)); // Kick upwards
+        pool.age[i] = 0;
+        pool.active |= (1u << i);
+        pool.count++;
+    }
+}
+
+static void Cull(int i)
+{
+    pool.active &= ~(1u << i);
+    pool.count--;
+}
+
+// Q8.8 velocity (units/s) over dt_ms -> Q8.8 displacement
+static int16_t Displace(int16_t v, uint32_t dt_ms)
+{
+    return (int16_t)(((int32_t)v * (int32_t)dt_ms) / 1000);
+}
+
+void Particles_Step(uint32_t dt_ms)
+{
+    if (dt_ms > PARTICLE_MAX_DT_MS) dt_ms = PARTICLE_MAX_DT_MS;
+
+    for (uint32_t bits = pool.active; bits; bits &= bits - 1)
+    {
+        int i = __builtin_ctz(bits);
+
+        pool.age[i] += (uint16_t)dt_ms;
+        if (pool.age[i] >= PARTICLE_LIFE_MS) {
+            Cull(i);
+            continue;
+        }
+
+        pool.vz[i] -= Displace(PARTICLE_GRAVITY, dt_ms);
+        pool.x[i] += Displace(pool.vx[i], dt_ms);
+        pool.y[i] += Displace(pool.vy[i], dt_ms);
+        pool.z[i] += Displace(pool.vz[i], dt_ms);
+
+        // Settle on the floor instead of bouncing: cheap and reads fine at 128x64
+        if (pool.z[i] < 0) {
+            pool.z[i] = 0;
+            pool.vx[i] = pool.vy[i] = pool.vz[i] = 0;
+        }
+
+        // A spark that flew into a wall is gone (it would draw through it otherwise)
+        if (Collision_IsSolid(pool.x[i] >> PARTICLE_FRAC_BITS, pool.y[i] >> PARTICLE_FRAC_BITS)) {
+            Cull(i);
+        }
+    }
+}
+
+const ParticlePool_t *Particles_Get(void)
+{
+    return &pool;
+}
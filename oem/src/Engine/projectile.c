@@ -0,0 +1,83 @@
+/* oem/src/Engine/projectile.c */
+#include "projectile.h"
+#include "collision.h"
+#include "gameLogic.h"
+#include <math.h>
+#include <string.h>
+
+#if PROJECTILE_CAPACITY > 32
+#error "Projectile pool mask is a single 32-bit word"
+#endif
+
+void Projectile_Clear(ProjectilePool_t *pool)
+{
+    memset(pool, 0, sizeof(*pool));
+}
+
+int Projectile_Spawn(ProjectilePool_t *pool, float x, float y, float dir_x, float dir_y)
+{
+    uint32_t free_bits = ~pool->active;
+    if (PROJECTILE_CAPACITY < 32) free_bits &= (1u << PROJECTILE_CAPACITY) - 1;
+    if (free_bits == 0) return -1;
+
+    float len = sqrtf(dir_x * dir_x + dir_y * dir_y);
+    if (len < 0.001f) return -1;
+
+    int i = __builtin_ctz(free_bits);
+    float step = PROJECTILE_SPEED * LOGIC_DT / len;
+
+    pool->x[i] = x;
+    pool->y[i] = y;
+    pool->vx[i] = dir_x * step;
+    pool->vy[i] = dir_y * step;
+    pool->ttl[i] = PROJECTILE_LIFETIME_S * LOGIC_HZ;
+    pool->active |= (1u << i);
+    pool->count++;
+    return i;
+}
+
+static void Despawn(ProjectilePool_t *pool, int i)
+{
+    pool->active &= ~(1u << i);
+    pool->count--;
+}
+
+int Projectile_Step(ProjectilePool_t *pool, const float *target_x, const float *target_y,
+                    int targets, uint8_t *hits)
+{
+    int total = 0;
+
+    for (int t = 0; t < targets; t++) hits[t] = 0;
+
+    for (uint32_t bits = pool->active; bits; bits &= bits - 1)
+    {
+        int i = __builtin_ctz(bits);
+
+        pool->x[i] += pool->vx[i];
+        pool->y[i] += pool->vy[i];
+
+        // Speed is well under a cell per tick, so checking the cell it lands in is a full sweep
+        int cx = (int)pool->x[i], cy = (int)pool->y[i];
+        if (--pool->ttl[i] == 0 || Collision_IsSolid(cx, cy)) {
+            Despawn(pool, i);
+            continue;
+        }
+
+        for (int t = 0; t < targets; t++)
+        {
+            // Broad phase on the grid: only projectiles in the player's cell or a neighbour are measured
+            int pcx = (int)target_x[t], pcy = (int)target_y[t];
+            if (cx < pcx - 1 || cx > pcx + 1 || cy < pcy - 1 || cy > pcy + 1) continue;
+
+            float dx = pool->x[i] - target_x[t];
+            float dy = pool->y[i] - target_y[t];
+            if (dx * dx + dy * dy < PROJECTILE_HIT_RADIUS * PROJECTILE_HIT_RADIUS) {
+                Despawn(pool, i);
+                hits[t]++;
+                total++;
+                break;
+            }
+        }
+    }
+    return total;
+}
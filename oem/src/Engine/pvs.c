@@ -0,0 +1,143 @@
+/* oem/src/Engine/pvs.c */
+#include "pvs.h"
+#include "timing.h"
+#include "crc32.h"
+#include <math.h>
+#include <string.h>
+
+static const PvsTable_t *active = NULL;     // NULL = no matching table: everything visible
+static PvsStats_t        stats;
+
+// Cell centre first (cheapest hit for open rooms), then the four inset corners
+static const float SAMPLE_U[5] = { 0.5f, PVS_SAMPLE_INSET, 1.0f - PVS_SAMPLE_INSET, PVS_SAMPLE_INSET, 1.0f - PVS_SAMPLE_INSET };
+static const float SAMPLE_V[5] = { 0.5f, PVS_SAMPLE_INSET, PVS_SAMPLE_INSET, 1.0f - PVS_SAMPLE_INSET, 1.0f - PVS_SAMPLE_INSET };
+
+static uint32_t SourceCrc(const Level_t *level)
+{
+    uint32_t crc = Crc32_Update(0xFFFFFFFFu, SAMPLE_U, sizeof(SAMPLE_U));
+    crc = Crc32_Update(crc, SAMPLE_V, sizeof(SAMPLE_V));
+    crc = Crc32_Update(crc, level->map, sizeof(level->map));
+    return crc ^ 0xFFFFFFFFu;
+}
+
+//
+// A CRC of the 256-byte map and a table pick: no line-of-sight work at runtime
+//
+void Pvs_LoadLevel(int level_index, const Level_t *level)
+{
+    uint32_t start = Timing_Now();
+
+    active = NULL;
+    if (level_index >= 0 && level_index < PVS_TABLE_COUNT &&
+        PvsTables[level_index].source_crc == SourceCrc(level)) {
+        active = &PvsTables[level_index];
+    }
+
+    stats.stale = (active == NULL);
+    stats.open_cells = active ? active->open_cells : 0;
+    stats.visible_pairs = active ? active->visible_pairs : 0;
+    stats.bytes = PVS_TABLE_COUNT * sizeof(PvsTable_t);
+    stats.load_us = Timing_CyclesToUs(Timing_Now() - start);
+}
+
+void Pvs_GetStats(PvsStats_t *out)
+{
+    *out = stats;
+}
+
+int Pvs_CanSee(int ax, int ay, int bx, int by)
+{
+    if ((unsigned)ax >= MAP_W || (unsigned)ay >= MAP_H || (unsigned)bx >= MAP_W || (unsigned)by >= MAP_H) return 0;
+    if (!active) return 1;
+
+    int b = bx * MAP_H + by;
+    return (active->rows[ax * MAP_H + ay][b >> 5] >> (b & 31)) & 1;
+}
+
+#ifdef HOST_BUILD
+// ==================== Table Generation (host) ====================
+
+static int IsSolid(const Level_t *level, int x, int y)
+{
+    if (x < 0 || x >= MAP_W || y < 0 || y >= MAP_H) return 1;
+    return level->map[x][y] != 0;
+}
+
+//
+// Grid walk (Amanatides-Woo) from p0 to p1; 0 if it enters a solid cell
+//
+static int SegmentClear(const Level_t *level, float x0, float y0, float x1, float y1)
+{
+    int cx = (int)x0, cy = (int)y0;
+    int ex = (int)x1, ey = (int)y1;
+    float dx = x1 - x0, dy = y1 - y0;
+
+    int stepX = (dx < 0) ? -1 : 1;
+    int stepY = (dy < 0) ? -1 : 1;
+    float tDeltaX = (dx != 0.0f) ? fabsf(1.0f / dx) : 1e30f;
+    float tDeltaY = (dy != 0.0f) ? fabsf(1.0f / dy) : 1e30f;
+    float tMaxX = (dx < 0) ? (x0 - cx) * tDeltaX : (cx + 1.0f - x0) * tDeltaX;
+    float tMaxY = (dy < 0) ? (y0 - cy) * tDeltaY : (cy + 1.0f - y0) * tDeltaY;
+
+    while (cx != ex || cy != ey)
+    {
+        // The next boundary lies beyond p1: float error kept us out of p1's cell, but we're done
+        float tNext = (tMaxX < tMaxY) ? tMaxX : tMaxY;
+        if (tNext > 1.0f) break;
+
+        if (tMaxX < tMaxY) { tMaxX += tDeltaX; cx += stepX; }
+        else               { tMaxY += tDeltaY; cy += stepY; }
+
+        if (IsSolid(level, cx, cy)) return 0;
+    }
+    return 1;
+}
+
+static int CellsSeeEachOther(const Level_t *level, int ax, int ay, int bx, int by)
+{
+    for (int s = 0; s < 5; s++) {
+        for (int t = 0; t < 5; t++) {
+            if (SegmentClear(level, ax + SAMPLE_U[s], ay + SAMPLE_V[s], bx + SAMPLE_U[t], by + SAMPLE_V[t])) return 1;
+        }
+    }
+    return 0;
+}
+
+static void SetBit(PvsTable_t *table, int a, int b)
+{
+    table->rows[a][b >> 5] |= (1u << (b & 31));
+}
+
+uint32_t Pvs_SourceCrc(const Level_t *level)
+{
+    return SourceCrc(level);
+}
+
+void Pvs_Compute(const Level_t *level, PvsTable_t *table)
+{
+    memset(table, 0, sizeof(*table));
+    table->source_crc = SourceCrc(level);
+
+    // Symmetric: test each unordered pair once and set both bits
+    for (int a = 0; a < PVS_CELLS; a++)
+    {
+        int ax = a / MAP_H, ay = a % MAP_H;
+        if (level->map[ax][ay] != 0) continue;
+
+        table->open_cells++;
+        SetBit(table, a, a);
+
+        for (int b = a + 1; b < PVS_CELLS; b++)
+        {
+            int bx = b / MAP_H, by = b % MAP_H;
+            if (level->map[bx][by] != 0) continue;
+
+            if (CellsSeeEachOther(level, ax, ay, bx, by)) {
+                SetBit(table, a, b);
+                SetBit(table, b, a);
+                table->visible_pairs++;
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,1303 @@
+/* oem/src/Engine/pvsTables.c */
+// Generated by oem/host/pvsGen.c from the maps in level.c (make -C oem/host pvs). Do not edit.
+#include "pvs.h"
+
+const PvsTable_t PvsTables[] = {
+    // Level 1: 190 open cells, 16687 visible pairs
+    { 0xEBBAEE5Bu, 190, 16687, {
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x77F67FFE, 0x7FCE07E6, 0x7E1E7F1E, 0x787E7C3E, 0x40FE707E, 0x01FE01FE, 0x000003FE },
+        { 0x7FFE0000, 0x77F67FFE, 0x3FEE07F6, 0x7ECE7F6E, 0x799E7DDE, 0x673E739E, 0x0E3E473E, 0x00001E7E },
+        { 0x7FFE0000, 0x77F67FFE, 0x3FF607F6, 0x7FF67F76, 0x7DF67FF6, 0x77F67BF6, 0x6FF677F6, 0x00005FF6 },
+        { 0x7FFE0000, 0x77F67FFE, 0x3FFA07F6, 0x7FF87F7A, 0x7FFC7FFC, 0x7BFE7FFC, 0x7FFE7FFE, 0x00004FFE },
+        { 0x7FFE0000, 0x77F67FFE, 0x1FF807F2, 0x7FFC7F7C, 0x7FFE7FFE, 0x7DFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F67FFE, 0x1FF847F2, 0x7FFE7F7C, 0x7FFE7FFE, 0x7EFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F67FFE, 0x1FFC47F0, 0x7F7E3F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x00005F7E },
+        { 0x7FFE0000, 0x77F67FFE, 0x0FFC67F0, 0x3FFE1F7E, 0x7FFE7FFE, 0x7FBE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F67FFE, 0x4FFC67F0, 0x1FFE1F7E, 0x7FFE3FFE, 0x7FDE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F67FFE, 0x6FFE77F0, 0x4FFE6F7E, 0x1FFE5FFE, 0x3FEE1FFE, 0x3FFE3FFE, 0x00001FFA },
+        { 0x7FFE0000, 0x77F67FFE, 0x77FE77F0, 0x77FE777E, 0x77DE77FE, 0x77F677EE, 0x77FA77F6, 0x000057FC },
+        { 0x7FFE0000, 0x77F67FFE, 0x7BFE77F0, 0x79BE7B7E, 0x7CCE7DDE, 0x7E727CE6, 0x7E387E70, 0x00005F1C },
+        { 0x7FFE0000, 0x77F67FFE, 0x79FE73F0, 0x7C3E7C7E, 0x7F0E7E1E, 0x7F807F02, 0x7FC07FC0, 0x00005FE0 },
+        { 0x7FFE0000, 0x77F67FFE, 0x78FE73F0, 0x7E1E7C7E, 0x7F827F0E, 0x7FE07FC0, 0x7FF87FF0, 0x00005FFC },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x77F67FFE, 0x7F0E07C6, 0x703E7C1E, 0x00FE407E, 0x03FE01FE, 0x0FFE07FE, 0x00001FFE },
+        { 0x7FFE0000, 0x77F67FFE, 0x7FCE07E6, 0x7E1E7F0E, 0x783E7C1E, 0x407E603E, 0x00FE007E, 0x000000FE },
+        { 0x7FFE0000, 0x77F67FFE, 0x7FF607F6, 0x7EF67F76, 0x79F67DF6, 0x63F673F6, 0x0FF647F6, 0x00000FF6 },
+        { 0x7FFE0000, 0x77F67FFE, 0x7FF807F2, 0x7FFC7F78, 0x7FFE7FFC, 0x7FFE7BFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F67FFE, 0x3FF807F0, 0x7FFE7F7C, 0x7FFE7EFE, 0x7FFE7DFE, 0x7FFE7BFE, 0x000057FE },
+        { 0x7FFE0000, 0x77F67FFE, 0x3FFC07F0, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7EFE, 0x7FFE7FFE, 0x00005DFE },
+        { 0x7FFE0000, 0x77F67FFE, 0x1FFC07F0, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x00005F7E },
+        { 0x7FFE0000, 0x77F67FFE, 0x1FFE07F0, 0x7FFE3F7E, 0x7FFE7FFE, 0x7FFE7FBE, 0x7FFE7FFE, 0x00005FDE },
+        { 0x7FFE0000, 0x77F67FFE, 0x0FFE47F0, 0x3FFE1F7E, 0x7FFE7FBE, 0x7FFE7FDE, 0x7FFE7FEE, 0x00005FF6 },
+        { 0x7FFE0000, 0x77F67FFE, 0x4FFE67F0, 0x1FFE0F7E, 0x3FFE1FFE, 0x7FFE3FEE, 0x7FFE7FFE, 0x00005FFC },
+        { 0x7FFE0000, 0x77F67FFE, 0x77FE77F0, 0x77BE777E, 0x77CE77DE, 0x77E277E6, 0x77F877F0, 0x000057F8 },
+        { 0x7FFE0000, 0x77F67FFE, 0x79FE73F0, 0x7C3E787E, 0x7E0E7C1E, 0x7F007E02, 0x7F807F00, 0x00005F80 },
+        { 0x7FFE0000, 0x77F67FFE, 0x787E71F0, 0x7E067C1E, 0x7F807F00, 0x7FE07FC0, 0x7FF87FF0, 0x00005FFC },
+        { 0x7FFE0000, 0x77F67FFE, 0x7C1E70F0, 0x7F807E02, 0x7FF07FC0, 0x7FFC7FF8, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x00067FFE, 0x001E0006, 0x01FE007E, 0x1FFE07FE, 0x7FFE3FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x00067FFE, 0x000E0006, 0x003E001E, 0x00FE007E, 0x03FE01FE, 0x0FFE07FE, 0x00000FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x07F07FFE, 0x7FF807F0, 0x7EFE7F7C, 0x7BFE7DFE, 0x6FFE77FE, 0x3FFE5FFE, 0x00001FFE },
+        { 0x7FFE0000, 0x07F07FFE, 0x7FFC07F0, 0x7FFE7F7E, 0x7DFE7FFE, 0x7FFE7FFE, 0x7FFE77FE, 0x00005FFE },
+        { 0x7FFE0000, 0x07F07FFE, 0x7FFE07F0, 0x7FFE7F7E, 0x7EFE7FFE, 0x7FFE7FFE, 0x7FFE7DFE, 0x00005FFE },
+        { 0x7FFE0000, 0x07F07FFE, 0x7FFE07F0, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x00005F7E },
+        { 0x7FFE0000, 0x07F07FFE, 0x3FFE07F0, 0x7FFE7F7E, 0x7FBE7FFE, 0x7FFE7FFE, 0x7FFE7FDE, 0x00005FFE },
+        { 0x7FFE0000, 0x07F07FFE, 0x1FFE07F0, 0x7FFE7F7E, 0x7FDE7FFE, 0x7FFE7FFE, 0x7FFE7FF6, 0x00005FFE },
+        { 0x7FFE0000, 0x07F07FFE, 0x0FFE07F0, 0x3FBE1F7E, 0x7FEE7FDE, 0x7FFA7FF6, 0x7FFE7FFC, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x70007FFE, 0x78007000, 0x7E007C00, 0x7F807F00, 0x7FE07FC0, 0x7FF87FF0, 0x00005FF8 },
+        { 0x7FFE0000, 0x70007FFE, 0x7C007000, 0x7FC07F00, 0x7FFC7FF0, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x70007FFE, 0x7E007000, 0x7FE07F00, 0x7FFE7FF8, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x007E0000, 0x0006001E, 0x7FFE0006, 0x43FE7F7E, 0x7FFE1FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x001E0000, 0x0006000E, 0x7FFE0006, 0x63FE7F7E, 0x7FFE0FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFC0000, 0x07F07FF8, 0x7FFE07F0, 0x7FFE7F7E, 0x7FFE7BFE, 0x7FFE5FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x07F07FFC, 0x7FFE07F0, 0x7EFE7F7E, 0x7BFE7DFE, 0x6FFE77FE, 0x3FFE5FFE, 0x00001FFE },
+        { 0x7FFE0000, 0x07F07FFE, 0x7FFE07F0, 0x7FFE7F7E, 0x7FFE7EFE, 0x7FFE7DFE, 0x7FFE7BFE, 0x000057FE },
+        { 0x7FFE0000, 0x07F07FFE, 0x7FFE07F0, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x00005F7E },
+        { 0x7FFE0000, 0x07F03FFE, 0x7FFE07F0, 0x7FFE7F7E, 0x7FFE7FBE, 0x7FFE7FDE, 0x7FFE7FEE, 0x00005FF6 },
+        { 0x7FFE0000, 0x07F01FFE, 0x7FFE07F0, 0x7FBE7F7E, 0x7FEE7FDE, 0x7FFA7FF6, 0x7FFE7FFC, 0x00005FFE },
+        { 0x1FFE0000, 0x07F00FFE, 0x7FFE07F0, 0x7FFE7F7E, 0x7FFE7FEE, 0x7FFE7FFC, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7C000000, 0x70007800, 0x7FFE7000, 0x7FE27F7E, 0x7FFE7FF8, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7F000000, 0x70007C00, 0x7FFE7000, 0x7FE07F7E, 0x7FFE7FFC, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FC00000, 0x70007E00, 0x7FFE7000, 0x7FF07F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7C1E0000, 0x07C67F0E, 0x7FFE77F6, 0x5FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7F8E0000, 0x07E67FCE, 0x7FFE77F6, 0x6FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF60000, 0x07F67FF6, 0x7FFE77F6, 0x77FE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF80000, 0x07F27FF8, 0x7FFE77F6, 0x7BFE7F7E, 0x7FFE5FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFC0000, 0x07F03FF8, 0x7FFE77F6, 0x7DFE7F7E, 0x5FFE77FE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x07F03FFC, 0x7FFE77F6, 0x7EFE7F7E, 0x7BFE7DFE, 0x6FFE77FE, 0x3FFE5FFE, 0x00001FFE },
+        { 0x7FFE0000, 0x07F01FFC, 0x7FFE77F6, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x00005F7E },
+        { 0x3FFE0000, 0x07F01FFE, 0x7FFE77F6, 0x7FBE7F7E, 0x7FEE7FDE, 0x7FFA7FF6, 0x7FFE7FFC, 0x00005FFE },
+        { 0x1FFE0000, 0x47F00FFE, 0x7FFE77F6, 0x7FDE7F7E, 0x7FFC7FF6, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x0FFE0000, 0x67F04FFE, 0x7FFE77F6, 0x7FEE7F7E, 0x7FFE7FFC, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77FE0000, 0x77F077FE, 0x7FFE77F6, 0x7FF67F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x78FE0000, 0x73F079FE, 0x7FFE77F6, 0x7FFA7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7C1E0000, 0x71F0787E, 0x7FFE77F6, 0x7FFC7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7E020000, 0x70F07C1E, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F9E0000, 0x07E67FCE, 0x7FFE77F6, 0x7FFE007E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FEE0000, 0x07F63FEE, 0x7FFE77F6, 0x7FFE007E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF60000, 0x07F63FF6, 0x7FFE77F6, 0x7FFE007E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFA0000, 0x07F63FFA, 0x7FFE77F6, 0x7FFE007E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFC0000, 0x07F21FF8, 0x7FFE77F6, 0x7FFE007E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFC0000, 0x07F21FF8, 0x7FFE77F6, 0x7FFE007E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x1FFE0000, 0x67F00FFC, 0x7FFE77F6, 0x7FFE7F00, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1FFE0000, 0x67F04FFC, 0x7FFE77F6, 0x7FFE7F00, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FFE0000, 0x77F06FFE, 0x7FFE77F6, 0x7FFE7F00, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77FE0000, 0x77F077FE, 0x7FFE77F6, 0x7FFE7F00, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFE0000, 0x77F07BFE, 0x7FFE77F6, 0x7FFE7F00, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7CFE0000, 0x73F079FE, 0x7FFE77F6, 0x7FFE7F00, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7C7E0000, 0x73F078FE, 0x7FFE77F6, 0x7FFE7F00, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FCE0000, 0x07F63FEE, 0x5FFE17F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FEE0000, 0x07F63FFE, 0x6FFE07F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF60000, 0x07F61FF6, 0x77FE07F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFA0000, 0x07F61FFE, 0x7BFE47F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x3FF80000, 0x47F61FFA, 0x7DFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x0FFC0000, 0x63F207F8, 0x7EFE75F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1F7C0000, 0x67724F78, 0x7F7E7776, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1FF80000, 0x67E24FF0, 0x7FBE77D6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x4FFE0000, 0x77F06FFC, 0x7FDE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FFE0000, 0x77F07FFC, 0x7FEE77F0, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77FE0000, 0x77F077FC, 0x7FF677F0, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFE0000, 0x77F07FFE, 0x7FFA77F0, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x79FE0000, 0x77F07BFE, 0x7FFC77F4, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7CFE0000, 0x73F079FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FEE0000, 0x07F61FEE, 0x7BFE47F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x07F61FFE, 0x7FFE67F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF60000, 0x47F61FF6, 0x7DFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x3FFE0000, 0x67F61FFE, 0x7FFE73F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x0FFA0000, 0x63F607FA, 0x7EFE75F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1FFC0000, 0x67F64DFA, 0x7FFE76F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1F7C0000, 0x67724F78, 0x7F7E7776, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5FFC0000, 0x77F26FD8, 0x7FFE77B6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FF80000, 0x77E26FF0, 0x7FBE77D6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F27FFC, 0x7FFE77E6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77FE0000, 0x77F077FC, 0x7FDE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F07FFC, 0x7FFE77F2, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFE0000, 0x77F07BFC, 0x7FEE77F0, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7DFE0000, 0x77F07BFE, 0x7FFE77F0, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FEE0000, 0x47F61FFE, 0x7DFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x3FFE0000, 0x67F61FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x3FF60000, 0x67F61FF6, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x0FFE0000, 0x63F647FE, 0x7EFE75F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x07FA0000, 0x65F647FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1FFA0000, 0x66F64FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5F7C0000, 0x77766F7A, 0x7F7E7776, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FFC0000, 0x77B26FF8, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FF00000, 0x77D27FF0, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF80000, 0x77E27FF0, 0x7FBE77D6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77FE0000, 0x77F277FC, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F27FFC, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFE0000, 0x77F07FFC, 0x7FDE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFE0000, 0x77F07BFC, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x3FEE0000, 0x67F61FFE, 0x7FFE73F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1FFE0000, 0x67F60FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x0FF60000, 0x63F647F6, 0x7EFE75F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x07FE0000, 0x67F643FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1FFA0000, 0x67F64DFE, 0x7FFE76F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5FFA0000, 0x77F66EFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5F7C0000, 0x77766F7A, 0x7F7E7776, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FFC0000, 0x77F66FBA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FFC0000, 0x77F27FD8, 0x7FFE77B6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF00000, 0x77F27FE0, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77F80000, 0x77E277F0, 0x7FBE77D6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFE0000, 0x77F27FF8, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFE0000, 0x77F27FFC, 0x7FFE77E6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFE0000, 0x77F07BFC, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x1FFE0000, 0x67F60FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x0FFE0000, 0x63F647FE, 0x7EFE75F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x07F60000, 0x67F647F6, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x1BFE0000, 0x67F647FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5DFE0000, 0x77F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5EFA0000, 0x77F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6F7A0000, 0x77766F7A, 0x7F7E7776, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FBC0000, 0x77F67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FDC0000, 0x77F67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FEC0000, 0x77F27FF0, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77F00000, 0x77F277F0, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF80000, 0x77E27FF0, 0x7FBE77D6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFC0000, 0x77F27FF8, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFE0000, 0x77F27FFC, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FFE0000, 0x63F647FE, 0x7EFE75F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x0FFE0000, 0x67F647FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x07F60000, 0x65F647F6, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5FFE0000, 0x77F66DFE, 0x7FFE76F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5FFE0000, 0x76F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFA0000, 0x77F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6F7A0000, 0x77766F7A, 0x7F7E7776, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FFE0000, 0x77F67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFC0000, 0x77B67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFC0000, 0x77F67FDA, 0x7FFE77B6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77F00000, 0x77D277F0, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF80000, 0x77F27FF0, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF80000, 0x77E27FF0, 0x7FBE77D6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BFC0000, 0x77F27FF8, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FFE0000, 0x67F647FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x07FE0000, 0x67F647FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5FF60000, 0x77F66FF6, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5FFE0000, 0x77F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x5FFE0000, 0x77F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FFA0000, 0x77F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6F7A0000, 0x77767F7E, 0x7F7E7776, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x6FFA0000, 0x77F67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFC0000, 0x77F67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FFC0000, 0x77F67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x77FC0000, 0x77F677FA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF00000, 0x77F27FF0, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7FF80000, 0x77F27FF0, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x7BF80000, 0x77E27FF0, 0x7FBE77D6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00005FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07FE0000, 0x67F643FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x5BFE0000, 0x67F667FE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x5FF60000, 0x77F66DF6, 0x7FFE76F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x5FFE0000, 0x77F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x6FFE0000, 0x77F66EFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x6FFE0000, 0x77F66FFE, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x6F7A0000, 0x77767F7E, 0x7F7E7776, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x7FFA0000, 0x77F67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x7FFE0000, 0x77F67FBA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x7FFC0000, 0x77F67FFA, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x77FC0000, 0x77F677DA, 0x7FFE77B6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x7FEC0000, 0x77F27FF2, 0x7FFE77F6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00001FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7BF80000, 0x77E27FF0, 0x7FBE77D6, 0x7FFE7F7E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00004000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    } },
+    // Level 2: 124 open cells, 1365 visible pairs
+    { 0x26D869BEu, 124, 1365, {
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x000001F8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x000000F8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x000000FC, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x02000780, 0x02000600, 0x00000600, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x02000780, 0x02000700, 0x01000700, 0x01000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x020003C0, 0x02000300, 0x01000300, 0x01000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x000003C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x000001C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x000001C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006001E, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x020003F8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x000601FC, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x000600FE, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x02000F80, 0x02000600, 0x00000600, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x020007C0, 0x02000700, 0x01000700, 0x01000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x020003C0, 0x02000300, 0x01000300, 0x01000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x000001C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x02067FFE, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x02067FFE, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x02067FFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x02067FFE, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700070, 0x02067FFE, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x02067FFE, 0x02000600, 0x00000600, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7F000000, 0x03007F00, 0x02067FFE, 0x02000700, 0x01000700, 0x01000100, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x03760046, 0x02067FFE, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00460000, 0x03760066, 0x02067FFE, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00760000, 0x03760076, 0x02067FFE, 0x00060006, 0x00060006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x03760072, 0x02067FFE, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x03760070, 0x02067FFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x3C700000, 0x03760E70, 0x02067FFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x3F700000, 0x03760F70, 0x02067FFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x3F100000, 0x03760F30, 0x02067FFE, 0x02000600, 0x00000600, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0F000000, 0x03760710, 0x02067FFE, 0x02000700, 0x01000700, 0x01800100, 0x00000000, 0x00000000 },
+        { 0x03000000, 0x03760300, 0x02067FFE, 0x02000300, 0x01000300, 0x01800100, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x03760100, 0x02067FFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x03760000, 0x02067FFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x03760000, 0x02067FFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x03760000, 0x02067FFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x03760066, 0x00067FFE, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x03760066, 0x00067FFE, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x03760710, 0x02007FFE, 0x02307FF0, 0x01000700, 0x01800180, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00460000, 0x00660066, 0x0006001E, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02307FF0, 0x00380030, 0x00600020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02307FF0, 0x00380030, 0x00700020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02307FF0, 0x00380030, 0x00300020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02307FF0, 0x00000010, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x06000000, 0x02000600, 0x02000600, 0x02307FF0, 0x00000600, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x03000700, 0x02000700, 0x02307FF0, 0x01800700, 0x01C00180, 0x00000000, 0x00000000 },
+        { 0x03000000, 0x03000300, 0x02000300, 0x02307FF0, 0x01000300, 0x01C00180, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02307FF0, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02307FF0, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02307FF0, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02307FF0, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x001E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x000E0006, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x00307FF0, 0x00380030, 0x00600020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x00307FF0, 0x003C0030, 0x00700020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x03000700, 0x02000700, 0x02007FF0, 0x61807F80, 0x01C00180, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x003E0006, 0x00000020, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x003E0006, 0x00000020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x003000F0, 0x003E0030, 0x00600020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00300070, 0x003E0030, 0x00700020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x61807F80, 0x01C00180, 0x00000000, 0x00000000 },
+        { 0x06000000, 0x02000600, 0x02000600, 0x02000600, 0x61807F80, 0x01C00180, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x03000700, 0x02000700, 0x02000700, 0x61807F80, 0x01C00180, 0x00000000, 0x00000000 },
+        { 0x03000000, 0x03000300, 0x02000300, 0x02000300, 0x61807F80, 0x00000080, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x61807F80, 0x00004000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x61807F80, 0x60006000, 0x20006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x61807F80, 0x60007000, 0x20006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x61807F80, 0x64007800, 0x20006400, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00060006, 0x003E0036, 0x00000020, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x0006000E, 0x00260006, 0x003E0036, 0x00000020, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060006, 0x00060006, 0x00360076, 0x003E0036, 0x00000020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00320070, 0x003E0036, 0x00600020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00300070, 0x003E0036, 0x00700020, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02000200, 0x01807F80, 0x01C00180, 0x00000000, 0x00000000 },
+        { 0x06000000, 0x02000600, 0x02000600, 0x02000600, 0x01807F80, 0x01E00180, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x60007F80, 0x6C007C00, 0x20006400, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x60007F80, 0x6C007C00, 0x20006400, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00300070, 0x003E0036, 0x01FE0020, 0x00000002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000000, 0x02000600, 0x01800780, 0x01FE0180, 0x00000002, 0x00000000 },
+        { 0x00000000, 0x02000000, 0x02000600, 0x02000600, 0x01800380, 0x01FE0180, 0x00000002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60000000, 0x6C007C00, 0x0E000C00, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60004000, 0x6C007C00, 0x0E004C00, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60006000, 0x6C007C00, 0x2E006C00, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60007000, 0x6C007C00, 0x20006400, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60007800, 0x6C007C00, 0x20006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01FE01A0, 0x00060002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01FE01A0, 0x00020002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01FE01A0, 0x00000002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00200060, 0x00200020, 0x01FE01A0, 0x00000002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00300070, 0x01300030, 0x01FE01A0, 0x00000002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x02300630, 0x01B003B0, 0x01FE01A0, 0x00000002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x02000600, 0x02000600, 0x01800380, 0x01FE01A0, 0x00000002, 0x00000000 },
+        { 0x06000000, 0x02000600, 0x02000600, 0x02000600, 0x01800380, 0x01FE01A0, 0x00000002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60004000, 0x0C007C00, 0x0E000C00, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60000000, 0x0C007C00, 0x0F000C00, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60007000, 0x60007C00, 0x20006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60007000, 0x60007C00, 0x20006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01FE01A0, 0x0FFE0002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60004000, 0x0C003C00, 0x0FFE0C00, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0C001C00, 0x0FFE0C00, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60007000, 0x60007000, 0x20006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60007000, 0x60007800, 0x20006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0C001C00, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0C001C00, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0C001C00, 0x0FFE0C02, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60007000, 0x60007000, 0x20006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    } },
+    // Level 3: 120 open cells, 1478 visible pairs
+    { 0xB7C7E5E5u, 120, 1478, {
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x000E0000, 0x0002000A, 0x00060002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x000E0000, 0x001A000A, 0x00020002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x000E0000, 0x0018000A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x00700820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x00300820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x00000820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x00000820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x00000820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x18000820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x1C000820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x60000000, 0x70006000, 0x40004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x60000000, 0x78006000, 0x60004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x000E0000, 0x00020002, 0x00060002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x000E0000, 0x7FF80008, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x7FF80020, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0FE00000, 0x7FF80800, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x60000000, 0x7FF86000, 0x40004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x60000000, 0x7FF86000, 0x60004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00020002, 0x00060002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x000C0000, 0x7FF86828, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x006C0000, 0x7FF86828, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00600000, 0x7FF86828, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00200000, 0x7FF86828, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x7FF86828, 0x03004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x7FF86828, 0x03804100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x7FF86828, 0x01804100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x08000000, 0x7FF86828, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x4C000000, 0x7FF86828, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x6C000000, 0x7FF86828, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x60000000, 0x7FF86828, 0x40004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x60000000, 0x7FF86828, 0x60004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00020002, 0x7FFE0002, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x7FF86828, 0x7FFE0100, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x60000000, 0x7FF86828, 0x7FFE4000, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00020002, 0x7FFE4102, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00020000, 0x00020002, 0x7FFE4102, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x00301010, 0x00600020, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x00381010, 0x00600020, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x00181010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x03000000, 0x7FFE4102, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x03800000, 0x7FFE4102, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x01800000, 0x7FFE4102, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x30001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x38001010, 0x0C000800, 0x06000400, 0x03000200, 0x00000000 },
+        { 0x40000000, 0x40004000, 0x7FFE4102, 0x18001010, 0x0C000800, 0x06000400, 0x03000200, 0x00000000 },
+        { 0x60000000, 0x60006000, 0x7FFE4102, 0x00001010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x7FFE0010, 0x00604822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x7FFE4102, 0x7FFE1000, 0x0C004822, 0x06000400, 0x03000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x00064822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x00024822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00300000, 0x7FFE1010, 0x00004822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00380000, 0x7FFE1010, 0x00604822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00180000, 0x7FFE1010, 0x00704822, 0x00180010, 0x000C0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x00304822, 0x00180010, 0x000C0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x00004822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x00004822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x00004822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x18004822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x7FFE1010, 0x1C004822, 0x06000400, 0x03000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x38000000, 0x7FFE1010, 0x0C004822, 0x06000400, 0x03000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x18000000, 0x7FFE1010, 0x40004822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x60004822, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x7FFE0002, 0x00000490, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00180000, 0x7FFE1010, 0x7FFE0020, 0x00180490, 0x000C0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x7FFE1010, 0x7FFE0800, 0x06000490, 0x03000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x7FFE1010, 0x7FFE4000, 0x00000490, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x7FFE4822, 0x00000490, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x7FFE4822, 0x00000490, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE4822, 0x00300490, 0x00600020, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00600000, 0x7FFE4822, 0x00380490, 0x006C0028, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00180000, 0x00700010, 0x7FFE4822, 0x00180490, 0x000C0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00180000, 0x00300010, 0x7FFE4822, 0x01800490, 0x01800080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE4822, 0x01C00490, 0x01C00080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE4822, 0x00C00490, 0x00C00080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE4822, 0x0C000490, 0x18000800, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x18001000, 0x7FFE4822, 0x0E000490, 0x1B000A00, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x1C001000, 0x7FFE4822, 0x06000490, 0x03000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x0C000000, 0x7FFE4822, 0x00000490, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x7FFE4822, 0x00000490, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x60000000, 0x7FFE4822, 0x00000490, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00600000, 0x7FFE4822, 0x7FFE0010, 0x006C6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE4822, 0x7FFE0080, 0x01C06AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x18001000, 0x7FFE4822, 0x7FFE0400, 0x1B006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE0490, 0x00066AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE0490, 0x001A6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00600000, 0x00300020, 0x7FFE0490, 0x001C6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00600000, 0x00380020, 0x7FFE0490, 0x006C6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180000, 0x7FFE0490, 0x00706AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01800000, 0x7FFE0490, 0x01B06AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01C00000, 0x7FFE0490, 0x01C06AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C00000, 0x7FFE0490, 0x06C06AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x18001000, 0x0C000800, 0x7FFE0490, 0x07006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x18001000, 0x0E000800, 0x7FFE0490, 0x1B006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06000000, 0x7FFE0490, 0x1C006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE0490, 0x2C006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE0490, 0x30006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE0490, 0x38006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE0490, 0x3FFE0002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00600000, 0x00300020, 0x7FFE0490, 0x3FFE0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180000, 0x7FFE0490, 0x3FFE0020, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01C00000, 0x7FFE0490, 0x3FFE0080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x18001000, 0x0C000800, 0x7FFE0490, 0x3FFE0200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06000000, 0x7FFE0490, 0x3FFE0800, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE0490, 0x3FFE6000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7FFE0490, 0x3FFE6000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00600000, 0x00300020, 0x001A0010, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00600000, 0x00300020, 0x001C0010, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x006C0000, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180000, 0x00700010, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01980000, 0x01B00090, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01C00000, 0x01C00080, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x18001000, 0x0CC00800, 0x06C00480, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x30000000, 0x18001000, 0x0C000800, 0x07000400, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1B000000, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06000000, 0x5C000400, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06000000, 0x6C000400, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x70000000, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    } },
+    // Level 4: 145 open cells, 4030 visible pairs
+    { 0x11691156u, 145, 4030, {
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x00066AAA, 0x00060002, 0x00060002, 0x00060002, 0x00060002, 0x00060002, 0x00000000 },
+        { 0x7FFE0000, 0x001A6AAA, 0x001A000A, 0x001A000A, 0x001A000A, 0x001A000A, 0x001A000A, 0x00000000 },
+        { 0x7FFE0000, 0x001C6AAA, 0x001C0008, 0x001C0008, 0x001C0008, 0x001C0008, 0x001C0008, 0x00000000 },
+        { 0x7FFE0000, 0x006C6AAA, 0x006C0028, 0x006C0028, 0x006C0028, 0x006C0028, 0x006C0028, 0x00000000 },
+        { 0x7FFE0000, 0x00706AAA, 0x00700020, 0x00700020, 0x00700020, 0x00700020, 0x00700020, 0x00000000 },
+        { 0x7FFE0000, 0x01B06AAA, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x00000000 },
+        { 0x7FFE0000, 0x01C06AAA, 0x01C00080, 0x01C00080, 0x01C00080, 0x01C00080, 0x01C00080, 0x00000000 },
+        { 0x7FFE0000, 0x06C06AAA, 0x06C00280, 0x06C00280, 0x06C00280, 0x06C00280, 0x06C00280, 0x00000000 },
+        { 0x7FFE0000, 0x07006AAA, 0x07000200, 0x07000200, 0x07000200, 0x07000200, 0x07000200, 0x00000000 },
+        { 0x7FFE0000, 0x1B006AAA, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x00000000 },
+        { 0x7FFE0000, 0x5C006AAA, 0x1C000800, 0x1C000800, 0x1C000800, 0x1C000800, 0x1C000800, 0x00000000 },
+        { 0x7FFE0000, 0x6C006AAA, 0x6C006800, 0x6C006800, 0x6C006800, 0x6C006800, 0x2C006800, 0x00000000 },
+        { 0x7FFE0000, 0x70006AAA, 0x70006000, 0x70006000, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x7FFE0000, 0x78006AAA, 0x70006800, 0x70006000, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE0002, 0x00066AAA, 0x00060002, 0x00060002, 0x00060002, 0x00060002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE0008, 0x001C6AAA, 0x001C0008, 0x001C0008, 0x001C0008, 0x001C0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE0020, 0x00706AAA, 0x00700020, 0x00700020, 0x00700020, 0x00700020, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE0080, 0x01C06AAA, 0x01C00080, 0x01C00080, 0x01C00080, 0x01C00080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE0200, 0x07006AAA, 0x07000200, 0x07000200, 0x07000200, 0x07000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE0800, 0x1C006AAA, 0x1C000800, 0x1C000800, 0x1C000800, 0x1C000800, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE6000, 0x70006AAA, 0x70006000, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE6000, 0x70006AAA, 0x70006000, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x7FFE6AAA, 0x00066AAA, 0x00060002, 0x00060002, 0x00060002, 0x00060002, 0x00000000 },
+        { 0x001A0000, 0x7FFE6AAA, 0x001A6AAA, 0x001A000A, 0x001A000A, 0x001A000A, 0x001A000A, 0x00000000 },
+        { 0x001C0000, 0x7FFE6AAA, 0x001C6AAA, 0x001C0008, 0x001C0008, 0x001C0008, 0x001C0008, 0x00000000 },
+        { 0x006C0000, 0x7FFE6AAA, 0x006C6AAA, 0x006C0028, 0x006C0028, 0x006C0028, 0x006C0028, 0x00000000 },
+        { 0x00700000, 0x7FFE6AAA, 0x00706AAA, 0x00700020, 0x00700020, 0x00700020, 0x00700020, 0x00000000 },
+        { 0x01B00000, 0x7FFE6AAA, 0x01B06AAA, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x00000000 },
+        { 0x01C00000, 0x7FFE6AAA, 0x01C06AAA, 0x01C00080, 0x01C00080, 0x01C00080, 0x01C00080, 0x00000000 },
+        { 0x06C00000, 0x7FFE6AAA, 0x06C06AAA, 0x06C00280, 0x06C00280, 0x06C00280, 0x06C00280, 0x00000000 },
+        { 0x07000000, 0x7FFE6AAA, 0x07006AAA, 0x07000200, 0x07000200, 0x07000200, 0x07000200, 0x00000000 },
+        { 0x1B000000, 0x7FFE6AAA, 0x1B006AAA, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x00000000 },
+        { 0x5C000000, 0x7FFE6AAA, 0x5C006AAA, 0x1C000800, 0x1C000800, 0x1C000800, 0x1C000800, 0x00000000 },
+        { 0x6C000000, 0x7FFE6AAA, 0x6C006AAA, 0x6C006800, 0x6C006800, 0x6C006800, 0x2C006800, 0x00000000 },
+        { 0x70000000, 0x7FFE6AAA, 0x70006AAA, 0x70006000, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x78000000, 0x7FFE6AAA, 0x78006AAA, 0x70006800, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x7FFE6AAA, 0x7FFE0002, 0x00066AAA, 0x00060002, 0x00060002, 0x00060002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x001C0000, 0x7FFE6AAA, 0x7FFE0008, 0x001C6AAA, 0x001C0008, 0x001C0008, 0x001C0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x7FFE6AAA, 0x7FFE0020, 0x00706AAA, 0x00700020, 0x00700020, 0x00700020, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x01C00000, 0x7FFE6AAA, 0x7FFE0080, 0x01C06AAA, 0x01C00080, 0x01C00080, 0x01C00080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x7FFE6AAA, 0x7FFE0200, 0x07006AAA, 0x07000200, 0x07000200, 0x07000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x5C000000, 0x7FFE6AAA, 0x7FFE0800, 0x5C006AAA, 0x1C000800, 0x1C000800, 0x1C000800, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x70000000, 0x7FFE6AAA, 0x7FFE6000, 0x70006AAA, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x70000000, 0x7FFE6AAA, 0x7FFE6000, 0x70006AAA, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x7FFE6AAA, 0x00066AAA, 0x00060002, 0x00060002, 0x00060002, 0x00000000 },
+        { 0x001A0000, 0x001A000A, 0x7FFE6AAA, 0x001A6AAA, 0x001A000A, 0x001A000A, 0x001A000A, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x7FFE6AAA, 0x001C6AAA, 0x001C0008, 0x001C0008, 0x001C0008, 0x00000000 },
+        { 0x006C0000, 0x006C0028, 0x7FFE6AAA, 0x006C6AAA, 0x006C0028, 0x006C0028, 0x006C0028, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x7FFE6AAA, 0x00706AAA, 0x00700020, 0x00700020, 0x00700020, 0x00000000 },
+        { 0x01B00000, 0x01B000A0, 0x7FFE6AAA, 0x01B06AAA, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x7FFE6AAA, 0x01C06AAA, 0x01C00080, 0x01C00080, 0x01C00080, 0x00000000 },
+        { 0x06C00000, 0x06C00280, 0x7FFE6AAA, 0x06C06AAA, 0x06C00280, 0x06C00280, 0x06C00280, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x7FFE6AAA, 0x07006AAA, 0x07000200, 0x07000200, 0x07000200, 0x00000000 },
+        { 0x1B000000, 0x1B000A00, 0x7FFE6AAA, 0x1B006AAA, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x00000000 },
+        { 0x1C000000, 0x5C000800, 0x7FFE6AAA, 0x5C006AAA, 0x1C000800, 0x1C000800, 0x1C000800, 0x00000000 },
+        { 0x6C000000, 0x6C006800, 0x7FFE6AAA, 0x6C006AAA, 0x6C006800, 0x6C006800, 0x2C006800, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x7FFE6AAA, 0x70006AAA, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x70000000, 0x78006000, 0x7FFE6AAA, 0x78006AAA, 0x70006000, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x7FFE6AAA, 0x7FFE0002, 0x00066AAA, 0x00060002, 0x00060002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x7FFE6AAA, 0x7FFE0008, 0x001C6AAA, 0x001C0008, 0x001C0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x7FFE6AAA, 0x7FFE0020, 0x00706AAA, 0x00700020, 0x00700020, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x7FFE6AAA, 0x7FFE0080, 0x01C06AAA, 0x01C00080, 0x01C00080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x7FFE6AAA, 0x7FFE0200, 0x07006AAA, 0x07000200, 0x07000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x1C000000, 0x5C000800, 0x7FFE6AAA, 0x7FFE0800, 0x5C006AAA, 0x1C000800, 0x1C000800, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x7FFE6AAA, 0x7FFE6000, 0x70006AAA, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x7FFE6AAA, 0x7FFE6000, 0x70006AAA, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x00060002, 0x7FFE6AAA, 0x00066AAA, 0x00060002, 0x00060002, 0x00000000 },
+        { 0x001A0000, 0x001A000A, 0x001A000A, 0x7FFE6AAA, 0x001A6AAA, 0x001A000A, 0x001A000A, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x001C0008, 0x7FFE6AAA, 0x001C6AAA, 0x001C0008, 0x001C0008, 0x00000000 },
+        { 0x006C0000, 0x006C0028, 0x006C0028, 0x7FFE6AAA, 0x006C6AAA, 0x006C0028, 0x006C0028, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x00700020, 0x7FFE6AAA, 0x00706AAA, 0x00700020, 0x00700020, 0x00000000 },
+        { 0x01B00000, 0x01B000A0, 0x01B000A0, 0x7FFE6AAA, 0x01B06AAA, 0x01B000A0, 0x01B000A0, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x01C00080, 0x7FFE6AAA, 0x01C06AAA, 0x01C00080, 0x01C00080, 0x00000000 },
+        { 0x06C00000, 0x06C00280, 0x06C00280, 0x7FFE6AAA, 0x06C06AAA, 0x06C00280, 0x06C00280, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x07000200, 0x7FFE6AAA, 0x07006AAA, 0x07000200, 0x07000200, 0x00000000 },
+        { 0x1B000000, 0x1B000A00, 0x1B000A00, 0x7FFE6AAA, 0x1B006AAA, 0x1B000A00, 0x1B000A00, 0x00000000 },
+        { 0x1C000000, 0x1C000800, 0x5C000800, 0x7FFE6AAA, 0x5C006AAA, 0x1C000800, 0x1C000800, 0x00000000 },
+        { 0x6C000000, 0x6C006800, 0x6C006800, 0x7FFE6AAA, 0x6C006AAA, 0x6C006800, 0x2C006800, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x70006AAA, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x78006800, 0x7FFE6AAA, 0x78006AAA, 0x70006000, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x00060002, 0x7FFE6AAA, 0x7FFE0002, 0x00066AAA, 0x00060002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x001C0008, 0x7FFE6AAA, 0x7FFE0008, 0x001C6AAA, 0x001C0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x00700020, 0x7FFE6AAA, 0x7FFE0020, 0x00706AAA, 0x00700020, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x01C00080, 0x7FFE6AAA, 0x7FFE0080, 0x01C06AAA, 0x01C00080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x07000200, 0x7FFE6AAA, 0x7FFE0200, 0x07006AAA, 0x07000200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x1C000000, 0x1C000800, 0x1C000800, 0x7FFE6AAA, 0x7FFE0800, 0x5C006AAA, 0x1C000800, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x7FFE6000, 0x70006AAA, 0x30006000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x7FFE6000, 0x70006AAA, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x00060002, 0x00060002, 0x7FFE6AAA, 0x00066AAA, 0x00060002, 0x00000000 },
+        { 0x001A0000, 0x001A000A, 0x001A000A, 0x001A000A, 0x7FFE6AAA, 0x001A6AAA, 0x001A000A, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x001C0008, 0x001C0008, 0x7FFE6AAA, 0x001C6AAA, 0x001C0008, 0x00000000 },
+        { 0x006C0000, 0x006C0028, 0x006C0028, 0x006C0028, 0x7FFE6AAA, 0x006C6AAA, 0x006C0028, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x00700020, 0x00700020, 0x7FFE6AAA, 0x00706AAA, 0x00700020, 0x00000000 },
+        { 0x01B00000, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x7FFE6AAA, 0x01B06AAA, 0x01B000A0, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x01C00080, 0x01C00080, 0x7FFE6AAA, 0x01C06AAA, 0x01C00080, 0x00000000 },
+        { 0x06C00000, 0x06C00280, 0x06C00280, 0x06C00280, 0x7FFE6AAA, 0x06C06AAA, 0x06C00280, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x07000200, 0x07000200, 0x7FFE6AAA, 0x07006AAA, 0x07000200, 0x00000000 },
+        { 0x1B000000, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x7FFE6AAA, 0x1B006AAA, 0x1B000A00, 0x00000000 },
+        { 0x1C000000, 0x1C000800, 0x1C000800, 0x5C000800, 0x7FFE6AAA, 0x5C006AAA, 0x1C000800, 0x00000000 },
+        { 0x6C000000, 0x6C006800, 0x6C006800, 0x6C006800, 0x7FFE6AAA, 0x6C006AAA, 0x2C006800, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x70006AAA, 0x30006000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x78006800, 0x7FFE6AAA, 0x78006AAA, 0x30006000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x00060002, 0x00060002, 0x7FFE6AAA, 0x7FFE0002, 0x00066AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x001C0008, 0x001C0008, 0x7FFE6AAA, 0x7FFE0008, 0x001C6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x00700020, 0x00700020, 0x7FFE6AAA, 0x7FFE0020, 0x00706AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x01C00080, 0x01C00080, 0x7FFE6AAA, 0x7FFE0080, 0x01C06AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x07000200, 0x07000200, 0x7FFE6AAA, 0x7FFE0200, 0x07006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x1C000000, 0x1C000800, 0x1C000800, 0x1C000800, 0x7FFE6AAA, 0x7FFE0800, 0x1C006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x7FFE6000, 0x30006AAA, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x7FFE6000, 0x30006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x00060002, 0x00060002, 0x00060002, 0x7FFE6AAA, 0x00066AAA, 0x00000000 },
+        { 0x001A0000, 0x001A000A, 0x001A000A, 0x001A000A, 0x001A000A, 0x7FFE6AAA, 0x001A6AAA, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x001C0008, 0x001C0008, 0x001C0008, 0x7FFE6AAA, 0x001C6AAA, 0x00000000 },
+        { 0x006C0000, 0x006C0028, 0x006C0028, 0x006C0028, 0x006C0028, 0x7FFE6AAA, 0x006C6AAA, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x00700020, 0x00700020, 0x00700020, 0x7FFE6AAA, 0x00706AAA, 0x00000000 },
+        { 0x01B00000, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x7FFE6AAA, 0x01B06AAA, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x01C00080, 0x01C00080, 0x01C00080, 0x7FFE6AAA, 0x01C06AAA, 0x00000000 },
+        { 0x06C00000, 0x06C00280, 0x06C00280, 0x06C00280, 0x06C00280, 0x7FFE6AAA, 0x06C06AAA, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x07000200, 0x07000200, 0x07000200, 0x7FFE6AAA, 0x07006AAA, 0x00000000 },
+        { 0x1B000000, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x7FFE6AAA, 0x1B006AAA, 0x00000000 },
+        { 0x1C000000, 0x1C000800, 0x1C000800, 0x1C000800, 0x5C000800, 0x7FFE6AAA, 0x1C006AAA, 0x00000000 },
+        { 0x6C000000, 0x6C006800, 0x6C006800, 0x6C006800, 0x6C006800, 0x7FFE6AAA, 0x2C006AAA, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x30006AAA, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x70006000, 0x78006800, 0x7FFE6AAA, 0x38006AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x00060002, 0x00060002, 0x00060002, 0x7FFE6AAA, 0x3FFE0002, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x001C0008, 0x001C0008, 0x001C0008, 0x7FFE6AAA, 0x3FFE0008, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x00700020, 0x00700020, 0x00700020, 0x7FFE6AAA, 0x3FFE0020, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x01C00080, 0x01C00080, 0x01C00080, 0x7FFE6AAA, 0x3FFE0080, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x07000200, 0x07000200, 0x07000200, 0x7FFE6AAA, 0x3FFE0200, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x1C000000, 0x1C000800, 0x1C000800, 0x1C000800, 0x1C000800, 0x7FFE6AAA, 0x3FFE0800, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x3FFE6000, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x70006000, 0x70006000, 0x7FFE6AAA, 0x3FFE6000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00060000, 0x00060002, 0x00060002, 0x00060002, 0x00060002, 0x00060002, 0x3FFE6AAA, 0x00000000 },
+        { 0x001A0000, 0x001A000A, 0x001A000A, 0x001A000A, 0x001A000A, 0x001A000A, 0x3FFE6AAA, 0x00000000 },
+        { 0x001C0000, 0x001C0008, 0x001C0008, 0x001C0008, 0x001C0008, 0x001C0008, 0x3FFE6AAA, 0x00000000 },
+        { 0x006C0000, 0x006C0028, 0x006C0028, 0x006C0028, 0x006C0028, 0x006C0028, 0x3FFE6AAA, 0x00000000 },
+        { 0x00700000, 0x00700020, 0x00700020, 0x00700020, 0x00700020, 0x00700020, 0x3FFE6AAA, 0x00000000 },
+        { 0x01B00000, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x01B000A0, 0x3FFE6AAA, 0x00000000 },
+        { 0x01C00000, 0x01C00080, 0x01C00080, 0x01C00080, 0x01C00080, 0x01C00080, 0x3FFE6AAA, 0x00000000 },
+        { 0x06C00000, 0x06C00280, 0x06C00280, 0x06C00280, 0x06C00280, 0x06C00280, 0x3FFE6AAA, 0x00000000 },
+        { 0x07000000, 0x07000200, 0x07000200, 0x07000200, 0x07000200, 0x07000200, 0x3FFE6AAA, 0x00000000 },
+        { 0x1B000000, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x1B000A00, 0x3FFE6AAA, 0x00000000 },
+        { 0x1C000000, 0x1C000800, 0x1C000800, 0x1C000800, 0x1C000800, 0x5C000800, 0x3FFE6AAA, 0x00000000 },
+        { 0x6C000000, 0x6C006800, 0x6C006800, 0x6C006800, 0x6C006800, 0x6C006800, 0x3FFE6AAA, 0x00000000 },
+        { 0x70000000, 0x70006000, 0x70006000, 0x70006000, 0x70006000, 0x70006000, 0x3FFE6AAA, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    } },
+    // Level 5: 193 open cells, 17872 visible pairs
+    { 0x0AF42281u, 193, 17872, {
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x41DE7B6E, 0x0F7E07BE, 0x7DFE3EFE, 0x77FE7BFE, 0x5FFE6FFE, 0x00003FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x67FE7B6E, 0x4FBE37FE, 0x7FFE7FFE, 0x7FFE7EFE, 0x7BFE7FFE, 0x000077FE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x6FFE7B6E, 0x77DE3FFE, 0x7FFE7FFE, 0x7FFE7FBE, 0x7F7E7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x6EEE7B6E, 0x7BEE3DEE, 0x6FEE77EE, 0x3FEE5FEE, 0x7FEE7FEE, 0x00007FEE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7DF67FFE, 0x7FFE7FFE, 0x7FFE77FA, 0x5FFC7FFE, 0x00003FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x3EFA7FFE, 0x7FFE7FFE, 0x7FFE7DFE, 0x7BFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x77767B6E, 0x5F7C6F7A, 0x7F7E3F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x00007F7E },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x6FBE7FFE, 0x7FFE7FFE, 0x7FFE3FDE, 0x7FEE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x77DE7FFE, 0x7FFE7FFE, 0x7FFE6FF6, 0x5FFC7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7BBA7B6E, 0x7BEE7BDE, 0x7BFA7BF6, 0x7BFE7BFC, 0x7BFE7BFE, 0x00007BFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFA7B6E, 0x7DF67FFE, 0x7FFE7FFE, 0x7FFE7EFE, 0x7F7E7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FF27B6E, 0x7EF87FF6, 0x7FFE7FFE, 0x7FFE7FBE, 0x7FEE7FFE, 0x00007FF6 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7DC07B6E, 0x7F787EF0, 0x7FDE7FBE, 0x7FF67FEE, 0x7FFC7FFA, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FC07B6E, 0x7FBC7FF0, 0x7FFE7FFE, 0x7FFC7FFA, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x01FE7B6E, 0x0FFE067E, 0x7FFE3BFE, 0x3FFE5FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x01DE7B6E, 0x1F7E07BE, 0x7DFE7EFE, 0x77FE7BFE, 0x5FFE6FFE, 0x00003FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x41FE7B6E, 0x0FFE03DE, 0x7FFE3FBE, 0x7FFE7F7E, 0x7FFE7EFE, 0x00007DFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x4FEE7B6E, 0x7FEE33EE, 0x7FEE5FEE, 0x7FEE7FEE, 0x7FEE7FEE, 0x00007FEE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x6EFE7B6E, 0x7BFE3DF6, 0x6FFE77FA, 0x3FFE5FFC, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x6FF67B6E, 0x7FFC1EFA, 0x7FFE7DFE, 0x7FFE7BFE, 0x7FFE77FE, 0x00006FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7F7E7B6E, 0x7F7E5F7C, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x00007F7E },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x77FA7B6E, 0x5FFE6FBC, 0x7FFE3FDE, 0x7FFE7FEE, 0x7FFE7FF6, 0x00007FFA },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FBA7B6E, 0x7FEE77DE, 0x7FFA6FF6, 0x7FFE5FFC, 0x7FFE3FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7BF87B6E, 0x7BFE7BE6, 0x7BFE7BFC, 0x7BFE7BFE, 0x7BFE7BFE, 0x00007BFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FC07B6E, 0x7FF87DE0, 0x7FFE7EFE, 0x7FFE7F7E, 0x7FFE7FBE, 0x00007FDE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7DC07B6E, 0x7F7C7EF0, 0x7FDE7FBE, 0x7FF67FEE, 0x7FFC7FFA, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FC07B6E, 0x7FF87F30, 0x7FFE7FEE, 0x7FFE7FFC, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7E007B6E, 0x7FE07F80, 0x7FFE7FF8, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x007E7B6E, 0x1FFE03FE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x003E7B6E, 0x03FE00FE, 0x3FFE0FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x01DE7B6E, 0x0F7E03BE, 0x7DFE3EFE, 0x77FE7BFE, 0x1FFE6FFE, 0x00001FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x01EE7B6E, 0x1FEE07EE, 0x7FEE7FEE, 0x7FEE7FEE, 0x7FEE7FEE, 0x00007FEE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x01F67B6E, 0x1FFC07FA, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x0EFA7B6E, 0x7BFE1DFE, 0x6FFE77FE, 0x3FFE5FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x4F787B6E, 0x7F7E3F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x7F7E7F7E, 0x00007F7E },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x6FB87B6E, 0x7FEE3FDC, 0x7FFA7FF6, 0x7FFE7FFC, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x77C07B6E, 0x5FFC6FF0, 0x7FFE3FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7BC07B6E, 0x7BFC7BF0, 0x7BFE7BFE, 0x7BFE7BFE, 0x7BFE7BFE, 0x00007BFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7DC07B6E, 0x7F787EE0, 0x7FDE7FBE, 0x7FF67FEE, 0x7FFC7FFA, 0x00007FFC },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7E007B6E, 0x7FE07F80, 0x7FFE7FF8, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7F007B6E, 0x7FFC7FE0, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7F807B6E, 0x7FFE7FF8, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE000E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE000E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE000E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE0060, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE0060, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE0300, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE0300, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7800, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7800, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7800, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7800, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x1FFE0000, 0x007E03FE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x03FE0000, 0x003E00FE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x0F7E0000, 0x01DE07BE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x1FEE0000, 0x01EE07EE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x1FFC0000, 0x01F607FA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x0EFA3DFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7E0000, 0x4F783F7E, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x6FB83FDE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x5FFC0000, 0x77C06FF0, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFC0000, 0x7BC07BF0, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F780000, 0x7DC07EF0, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FE00000, 0x7E007F80, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFC0000, 0x7F007FE0, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7F807FF8, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x1FFE0000, 0x00FE067E, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x1F7E0000, 0x01DE07BE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x0FFE0000, 0x41FE03DE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x47EE33EE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x6EFE3DF6, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFC0000, 0x6FF61EFA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7E0000, 0x7F7E5F7C, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x5FFE0000, 0x77FA6FBC, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FBA77DE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x7BF07BE6, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FF80000, 0x7FC07DE0, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7C0000, 0x7DC07EF0, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFC0000, 0x7F807F30, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FE00000, 0x7E007F80, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x0F7E0000, 0x41DE07BE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x4FBE0000, 0x67FE17FE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x77DE0000, 0x6FFE3FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BEE0000, 0x6EEE3DEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7DF60000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x3EFA0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x5F7C0000, 0x77766F7A, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x6FBE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x77DE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BEE0000, 0x7BBA7BDE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7DF60000, 0x7FFA7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7EF80000, 0x7FF27FF4, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F780000, 0x7DC07EF0, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FBC0000, 0x7FC07FF0, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x6FFE3BFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x6FFE3FDE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x7EFE7DFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FEE5FEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7EFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x5FFE0000, 0x77FE6FF6, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7E0000, 0x7F7E7F7E, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFC0000, 0x7FF677FA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FBE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x7BFE7BFC, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FBE7FDE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFA7DFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFA7FEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7C0000, 0x7DF27EF4, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x7EFE7DFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FEE7FEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x5FFE0000, 0x77FE6FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7E0000, 0x7F7E7F7E, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFC0000, 0x7FF67FFA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x7BFE7BFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FBE7FDE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFA7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7BFE0000, 0x7EFE5DDE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x3FDE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7DFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x5FEE0000, 0x77EE6EEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7EFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x6FF60000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7E0000, 0x7F7E7776, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x77FA0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FBE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFC0000, 0x7BF67BBA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FDE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7DFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FBE7DDC, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7EFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x3FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x5FFE0000, 0x77FE6FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FEE7FEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7E0000, 0x7F7E7F7E, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x7BFE7BFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFC0000, 0x7FF67FFA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FBE7FDC, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x5FFE0000, 0x77FE6FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7EFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FEE7FEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE77FE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7E0000, 0x7F7E7F7E, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FF6, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x7BFE7BFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FBE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFC0000, 0x7FF67FFA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7DFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x5DDE0000, 0x77FE6FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x6EEE0000, 0x7FEE7FEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x77760000, 0x7F7E7F7E, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BBA0000, 0x7BFE7BFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7DDC0000, 0x7FF67FFA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FF67FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x7FFE0000, 0x77FE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7EFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x6FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FEE0000, 0x7FEE7FEE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE77FE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7F7E0000, 0x7F7E7F7E, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FF6, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7BFE0000, 0x7BFE7BFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFA0000, 0x7FFE7FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FFE7FBE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FFE0000, 0x7FF67FFE, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x7FDC0000, 0x7FF67FFA, 0x7FFE7B6E, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x7FFE7FFE, 0x00007FFE },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    } },
+};
+
+const int PVS_TABLE_COUNT = 5;
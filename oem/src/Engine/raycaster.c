@@ -2,6 +2,7 @@
 #include "display.h"
 #include "levels.h"
 #include "gameLogic.h"
+#include "pvs.h"
 #include <math.h>
 #include <stdlib.h> // Required for abs()
 
@@ -37,14 +38,45 @@ static const uint16_t EnemySprite[16] = {
     0x0000
 };
 
+// 16x16 Ally Sprite: the other board's player (helmet and shoulders)
+//    . . . . . X X X X X X . . . . .
+//    . . . . X X . . . . X X . . . .
+//    . . . . X X X X X X X X . . . .
+//    . . . . . X X X X X X . . . . .
+//    . . X X X X X X X X X X X X . .
+//    . X X . . X X X X X X . . X X .
+//    . X X . . X X X X X X . . X X .
+//    . . . . . X X X X X X . . . . .
+//    . . . . . X X . . X X . . . . .
+static const uint16_t AllySprite[16] = {
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x07E0, // 0000 0111 1110 0000 (Helmet)
+    0x0C30, // 0000 1100 0011 0000 (Visor)
+    0x0FF0, // 0000 1111 1111 0000
+    0x07E0, // 0000 0111 1110 0000
+    0x3FFC, // 0011 1111 1111 1100 (Shoulders)
+    0x67E6, // 0110 0111 1110 0110
+    0x67E6,
+    0x07E0, // 0000 0111 1110 0000 (Body)
+    0x07E0,
+    0x0660, // 0000 0110 0110 0000 (Legs)
+    0x0660,
+    0x0660
+};
+
 // Global Z-Buffer to track wall distances for sprite occlusion
 static float ZBuffer[SSD1306_WIDTH];
 
 //
 // Performs the Vector/Wireframe Raycasting loop
 //
-void Render_3D_View(void)
+void Render_3D_View(const Camera_t *cam)
 {
+	const Level_t *level = Game_Level();
+
 	// Iterate through every vertical column of the screen
 	for (int x = 0; x < SSD1306_WIDTH; x++)
 	{
@@ -52,11 +84,11 @@ void Render_3D_View(void)
 		// 1. Ray Casting Math
 		// ============================================
 		float cameraX = 2 * x / (float)SSD1306_WIDTH - 1;
-		float rayDirX = Game.player.dir_x + Game.player.plane_x * cameraX;
-		float rayDirY = Game.player.dir_y + Game.player.plane_y * cameraX;
+		float rayDirX = cam->dir_x + cam->plane_x * cameraX;
+		float rayDirY = cam->dir_y + cam->plane_y * cameraX;
 
-		int mapX = (int)Game.player.x;
-		int mapY = (int)Game.player.y;
+		int mapX = (int)cam->x;
+		int mapY = (int)cam->y;
 
 		float sideDistX, sideDistY;
 		float deltaDistX = fabsf(1 / rayDirX);
@@ -64,10 +96,10 @@ void Render_3D_View(void)
 		float perpWallDist;
 		int stepX, stepY, hit = 0, side;
 
-		if (rayDirX < 0) { stepX = -1; sideDistX = (Game.player.x - mapX) * deltaDistX; }
-		else { stepX = 1; sideDistX = (mapX + 1.0 - Game.player.x) * deltaDistX; }
-		if (rayDirY < 0) { stepY = -1; sideDistY = (Game.player.y - mapY) * deltaDistY; }
-		else { stepY = 1; sideDistY = (mapY + 1.0 - Game.player.y) * deltaDistY; }
+		if (rayDirX < 0) { stepX = -1; sideDistX = (cam->x - mapX) * deltaDistX; }
+		else { stepX = 1; sideDistX = (mapX + 1.0 - cam->x) * deltaDistX; }
+		if (rayDirY < 0) { stepY = -1; sideDistY = (cam->y - mapY) * deltaDistY; }
+		else { stepY = 1; sideDistY = (mapY + 1.0 - cam->y) * deltaDistY; }
 
 		// DDA Loop
 		while (hit == 0)
@@ -76,12 +108,15 @@ void Render_3D_View(void)
 			else { sideDistY += deltaDistY; mapY += stepY; side = 1; }
 
 			// Check for wall hit
-			if (Game.current_level->map[mapX][mapY] > 0) hit = 1;
+			if (level->map[mapX][mapY] > 0) hit = 1;
 		}
 
 		// Calculate final perpendicular distance
-		if (side == 0) perpWallDist = (mapX - Game.player.x + (1 - stepX) / 2) / rayDirX;
-		else           perpWallDist = (mapY - Game.player.y + (1 - stepY) / 2) / rayDirY;
+		if (side == 0) perpWallDist = (mapX - cam->x + (1 - stepX) / 2) / rayDirX;
+		else           perpWallDist = (mapY - cam->y + (1 - stepY) / 2) / rayDirY;
+
+		// Collision keeps the camera PLAYER_RADIUS away, but never trust a near-zero divisor
+		if (perpWallDist < NEAR_PLANE_DIST) perpWallDist = NEAR_PLANE_DIST;
 
 		// --- FIX: Store Z-Buffer value AFTER calculation ---
 		ZBuffer[x] = perpWallDist;
@@ -104,7 +139,7 @@ void Render_3D_View(void)
 		SetPixel(x, drawEnd, 1);
 
 		// B. Determine Wall Type
-		uint8_t tileID = Game.current_level->map[mapX][mapY];
+		uint8_t tileID = level->map[mapX][mapY];
 
 		// C. Draw Visual Style based on Wall Type/Side
 		if (tileID == 9)
@@ -125,166 +160,293 @@ void Render_3D_View(void)
 }
 
 //
-// Casts a single ray (used for Shooting/Hitscan logic)
+// Casts a batch of rays from one origin (hitscan, line-of-sight, pellet spreads)
+// The per-origin work (map cell, fractional offsets, level pointer) is done once;
+// each ray only pays for its reciprocals and its bounded DDA walk.
 //
+int Raycast_CastBatch(const RayBatch_t *batch, const float *offsets, RayHit_t *hits, int count)
+{
+    const Level_t *level = Game_Level();
+    int hit_count = 0;
+
+    if (count > RAY_BATCH_MAX) count = RAY_BATCH_MAX;
+
+    // 1. Shared setup
+    int originMapX = (int)batch->origin_x;
+    int originMapY = (int)batch->origin_y;
+    float fracX = batch->origin_x - originMapX; // Distance to the low cell edge
+    float fracY = batch->origin_y - originMapY;
+    int maxSteps = batch->max_steps ? batch->max_steps : RAY_MAX_STEPS;
+
+    for (int i = 0; i < count; i++)
+    {
+        float offset = offsets ? offsets[i] : 0.0f;
+        float rayDirX = batch->dir_x + batch->plane_x * offset;
+        float rayDirY = batch->dir_y + batch->plane_y * offset;
+
+        // 2. Per-ray DDA setup
+        int mapX = originMapX;
+        int mapY = originMapY;
+        float deltaDistX = (rayDirX == 0.0f) ? 1e30f : fabsf(1.0f / rayDirX);
+        float deltaDistY = (rayDirY == 0.0f) ? 1e30f : fabsf(1.0f / rayDirY);
+        float sideDistX, sideDistY;
+        int stepX, stepY, side = 0;
+
+        if (rayDirX < 0) { stepX = -1; sideDistX = fracX * deltaDistX; }
+        else             { stepX =  1; sideDistX = (1.0f - fracX) * deltaDistX; }
+        if (rayDirY < 0) { stepY = -1; sideDistY = fracY * deltaDistY; }
+        else             { stepY =  1; sideDistY = (1.0f - fracY) * deltaDistY; }
+
+        // 3. Bounded DDA walk
+        uint8_t tile = 0;
+        float distance = RAY_MISS_DIST;
+
+        for (int step = 0; step < maxSteps; step++)
+        {
+            if (sideDistX < sideDistY) { sideDistX += deltaDistX; mapX += stepX; side = 0; }
+            else                       { sideDistY += deltaDistY; mapY += stepY; side = 1; }
+
+            // Leaving the map counts as a miss (map[-1] or map[16] would Hard Fault)
+            if (mapX < 0 || mapX >= MAP_W || mapY < 0 || mapY >= MAP_H) break;
+
+            if (level->map[mapX][mapY] > 0)
+            {
+                tile = level->map[mapX][mapY];
+                distance = (side == 0) ? (sideDistX - deltaDistX) : (sideDistY - deltaDistY);
+                hit_count++;
+                break;
+            }
+        }
+
+        hits[i].distance = distance;
+        hits[i].cell_x = (int8_t)mapX;
+        hits[i].cell_y = (int8_t)mapY;
+        hits[i].tile = tile;
+        hits[i].side = (uint8_t)side;
+    }
+
+    return hit_count;
+}
+
 //
-// Casts a single ray (used for Shooting/Hitscan logic)
-// FIX: Added bounds checking to prevent system crash when shooting into void
+// Casts a single ray relative to the player's facing (kept for callers that aim by angle)
+// The angle becomes a spread offset along the unit perpendicular, so it costs one tanf
+// instead of rotating the direction with sinf/cosf.
 //
 float Raycast_CastSingle(float angle_offset, uint8_t *hit_type)
 {
-    // 1. Calculate ray direction based on player angle and offset
-    float rayDirX = Game.player.dir_x;
-    float rayDirY = Game.player.dir_y;
-
-    // Apply simple rotation if offset is non-zero (optional, usually 0 for center aim)
-    if (angle_offset != 0.0f) {
-        float oldDirX = rayDirX;
-        rayDirX = rayDirX * cosf(angle_offset) - rayDirY * sinf(angle_offset);
-        rayDirY = oldDirX * sinf(angle_offset) + rayDirY * cosf(angle_offset);
-    }
+    RayBatch_t batch = {
+        .origin_x = Game.player.x, .origin_y = Game.player.y,
+        .dir_x = Game.player.dir_x, .dir_y = Game.player.dir_y,
+        .plane_x = -Game.player.dir_y, .plane_y = Game.player.dir_x,
+        .max_steps = 0
+    };
+    float offset = (angle_offset != 0.0f) ? tanf(angle_offset) : 0.0f;
+    RayHit_t hit;
+
+    Raycast_CastBatch(&batch, &offset, &hit, 1);
+
+    if (hit_type) *hit_type = hit.tile;
+    if (hit.tile == 0) return RAY_MISS_DIST;
+
+    // Convert from ray-vector units back to world distance along the aimed ray
+    return hit.distance * sqrtf(1.0f + offset * offset);
+}
+
+//
+// Segment visibility test (enemy line-of-sight)
+// The ray vector is the segment itself, so the target sits at distance 1.0.
+//
+int Raycast_LineOfSight(float x0, float y0, float x1, float y1)
+{
+    RayBatch_t batch = {
+        .origin_x = x0, .origin_y = y0,
+        .dir_x = x1 - x0, .dir_y = y1 - y0,
+        .plane_x = 0.0f, .plane_y = 0.0f,
+        .max_steps = 0
+    };
+    RayHit_t hit;
+
+    Raycast_CastBatch(&batch, NULL, &hit, 1);
+    return (hit.tile == 0 || hit.distance >= 1.0f);
+}
+
+//
+// Draws 3D sprites (Enemies) using the Z-Buffer for occlusion
+//
+//
+// One 16x16 billboard standing on the floor at (x, y), Z-tested per column
+//
+static void DrawSprite(const Camera_t *cam, float x, float y, const uint16_t *bitmap)
+{
+    // Cell can't be seen from the camera's cell: no projection needed
+    if (!Pvs_CanSee((int)cam->x, (int)cam->y, (int)x, (int)y)) return;
 
-    // 2. DDA Setup
-    int mapX = (int)Game.player.x;
-    int mapY = (int)Game.player.y;
+    // --- 1. Sprite Projection Math (Same as before) ---
+    float spriteX = x - cam->x;
+    float spriteY = y - cam->y;
 
-    float deltaDistX = fabsf(1.0f / rayDirX);
-    float deltaDistY = fabsf(1.0f / rayDirY);
+    float invDet = 1.0f / (cam->plane_x * cam->dir_y - cam->dir_x * cam->plane_y);
 
-    float sideDistX, sideDistY;
-    int stepX, stepY;
-    int hit = 0;
-    int side;
+    float transformX = invDet * (cam->dir_y * spriteX - cam->dir_x * spriteY);
+    float transformY = invDet * (-cam->plane_y * spriteX + cam->plane_x * spriteY);
 
-    if (rayDirX < 0) {
-        stepX = -1;
-        sideDistX = (Game.player.x - mapX) * deltaDistX;
-    } else {
-        stepX = 1;
-        sideDistX = (mapX + 1.0f - Game.player.x) * deltaDistX;
-    }
+    if (transformY <= 0.1f) return;
 
-    if (rayDirY < 0) {
-        stepY = -1;
-        sideDistY = (Game.player.y - mapY) * deltaDistY;
-    } else {
-        stepY = 1;
-        sideDistY = (mapY + 1.0f - Game.player.y) * deltaDistY;
-    }
+    int spriteScreenX = (int)((SSD1306_WIDTH / 2) * (1 + transformX / transformY));
+    int spriteHeight = abs((int)(SSD1306_HEIGHT / transformY));
+    int spriteWidth = abs((int)(SSD1306_HEIGHT / transformY));
+
+    int drawStartY = -spriteHeight / 2 + SSD1306_HEIGHT / 2;
+    if(drawStartY < 0) drawStartY = 0;
+    int drawEndY = spriteHeight / 2 + SSD1306_HEIGHT / 2;
+    if(drawEndY >= SSD1306_HEIGHT) drawEndY = SSD1306_HEIGHT - 1;
 
-    // 3. DDA Execution
-    float distance_traveled = 0;
+    int drawStartX = -spriteWidth / 2 + spriteScreenX;
+    if(drawStartX < 0) drawStartX = 0;
+    int drawEndX = spriteWidth / 2 + spriteScreenX;
+    if(drawEndX >= SSD1306_WIDTH) drawEndX = SSD1306_WIDTH - 1;
 
-    // We limit distance to 20.0f to prevent infinite loops if bounds check fails
-    while (hit == 0 && distance_traveled < 20.0f)
+    // --- 2. Texture Mapping Loop ---
+    for(int stripe = drawStartX; stripe < drawEndX; stripe++)
     {
-        // Jump to next map square
-        if (sideDistX < sideDistY) {
-            distance_traveled = sideDistX;
-            sideDistX += deltaDistX;
-            mapX += stepX;
-            side = 0;
-        } else {
-            distance_traveled = sideDistY;
-            sideDistY += deltaDistY;
-            mapY += stepY;
-            side = 1;
-        }
+        // Calculate which column of the texture (0-15) to draw
+        // Math: (CurrentX - StartX) * TexWidth / TotalWidth
+        int texX = (int)(256 * (stripe - (-spriteWidth / 2 + spriteScreenX)) * 16 / spriteWidth) / 256;
 
-        // --- FIX: CRASH PREVENTION (Bounds Check) ---
-        // If ray goes outside the map array [0..15], STOP immediately.
-        // Accessing map[-1] or map[16] causes the Hard Fault reset.
-        if (mapX < 0 || mapX >= MAP_W|| mapY < 0 || mapY >= MAP_H) {
-            hit = 1;
-            if (hit_type) *hit_type = 0; // Return 0 (Air) so we don't count it as a wall hit
-            break;
-        }
+        // Safety clamp
+        if(texX < 0) texX = 0;
+        if(texX > 15) texX = 15;
 
-        // Check if ray hit a wall or entity (>0 in the map array)
-        if (Game.current_level->map[mapX][mapY] > 0) {
-            hit = 1;
-            if (hit_type) *hit_type = Game.current_level->map[mapX][mapY];
+        // Z-BUFFER CHECK
+        if(transformY < ZBuffer[stripe])
+        {
+            for(int y = drawStartY; y < drawEndY; y++)
+            {
+                // Calculate Y coordinate on texture (0-15)
+                // Math: (CurrentY - StartY) * TexHeight / TotalHeight
+                int d = (y) * 256 - SSD1306_HEIGHT * 128 + spriteHeight * 128;
+                int texY = ((d * 16) / spriteHeight) / 256;
+
+                if(texY < 0) texY = 0;
+                if(texY > 15) texY = 15;
+
+                // Read the bit from the sprite array
+                // We shift 1 by (15 - texX) because bit 15 is the leftmost pixel
+                uint16_t color = (bitmap[texY] >> (15 - texX)) & 1;
+
+                // Draw only if the pixel is White (1)
+                // (Leave 0 as transparent so we see walls behind legs/arms)
+                if(color != 0) {
+                    SetPixel(stripe, y, 1);
+                }
+            }
         }
     }
-
-    // 4. Calculate final perpendicular distance
-    float perpWallDist;
-    if (side == 0) perpWallDist = (mapX - Game.player.x + (1 - stepX) / 2.0f) / rayDirX;
-    else           perpWallDist = (mapY - Game.player.y + (1 - stepY) / 2.0f) / rayDirY;
-
-    return (hit) ? perpWallDist : 20.0f;
 }
 
-//
-// Draws 3D sprites (Enemies) using the Z-Buffer for occlusion
-//
-void Render_Enemies(void)
+void Render_Enemies(const Camera_t *cam, const SpritePos_t *sprites, int count)
 {
     // Loop through all active enemies
-    for(int i = 0; i < 5; i++)
+    for(int i = 0; i < count; i++)
     {
-        if (!Game.enemies[i].active) continue;
+        if (sprites[i].active) DrawSprite(cam, sprites[i].x, sprites[i].y, EnemySprite);
+    }
+}
 
-        // --- 1. Sprite Projection Math (Same as before) ---
-        float spriteX = Game.enemies[i].x - Game.player.x;
-        float spriteY = Game.enemies[i].y - Game.player.y;
+void Render_Ally(const Camera_t *cam, const SpritePos_t *ally)
+{
+    if (ally->active) DrawSprite(cam, ally->x, ally->y, AllySprite);
+}
 
-        float invDet = 1.0f / (Game.player.plane_x * Game.player.dir_y - Game.player.dir_x * Game.player.plane_y);
+void Render_Projectiles(const Camera_t *cam, const SpritePos_t *shots, int count)
+{
+    float invDet = 1.0f / (cam->plane_x * cam->dir_y - cam->dir_x * cam->plane_y);
 
-        float transformX = invDet * (Game.player.dir_y * spriteX - Game.player.dir_x * spriteY);
-        float transformY = invDet * (-Game.player.plane_y * spriteX + Game.player.plane_x * spriteY);
+    for (int i = 0; i < count; i++)
+    {
+        if (!shots[i].active) continue;
 
-        if (transformY <= 0.1f) continue;
+        float spriteX = shots[i].x - cam->x;
+        float spriteY = shots[i].y - cam->y;
 
-        int spriteScreenX = (int)((SSD1306_WIDTH / 2) * (1 + transformX / transformY));
-        int spriteHeight = abs((int)(SSD1306_HEIGHT / transformY));
-        int spriteWidth = abs((int)(SSD1306_HEIGHT / transformY));
+        float transformX = invDet * (cam->dir_y * spriteX - cam->dir_x * spriteY);
+        float transformY = invDet * (-cam->plane_y * spriteX + cam->plane_x * spriteY);
 
-        int drawStartY = -spriteHeight / 2 + SSD1306_HEIGHT / 2;
-        if(drawStartY < 0) drawStartY = 0;
-        int drawEndY = spriteHeight / 2 + SSD1306_HEIGHT / 2;
-        if(drawEndY >= SSD1306_HEIGHT) drawEndY = SSD1306_HEIGHT - 1;
+        if (transformY <= 0.1f) continue;
 
-        int drawStartX = -spriteWidth / 2 + spriteScreenX;
-        if(drawStartX < 0) drawStartX = 0;
-        int drawEndX = spriteWidth / 2 + spriteScreenX;
-        if(drawEndX >= SSD1306_WIDTH) drawEndX = SSD1306_WIDTH - 1;
+        // A quarter of an enemy's size, centred at eye height; never smaller than 2x2
+        int screenX = (int)((SSD1306_WIDTH / 2) * (1 + transformX / transformY));
+        int size = abs((int)(SSD1306_HEIGHT / transformY)) / 4;
+        if (size < 2) size = 2;
 
-        // --- 2. Texture Mapping Loop ---
-        for(int stripe = drawStartX; stripe < drawEndX; stripe++)
+        int startX = screenX - size / 2;
+        int startY = SSD1306_HEIGHT / 2 - size / 2;
+
+        for (int stripe = startX; stripe < startX + size; stripe++)
         {
-            // Calculate which column of the texture (0-15) to draw
-            // Math: (CurrentX - StartX) * TexWidth / TotalWidth
-            int texX = (int)(256 * (stripe - (-spriteWidth / 2 + spriteScreenX)) * 16 / spriteWidth) / 256;
+            if (stripe < 0 || stripe >= SSD1306_WIDTH) continue;
+            if (transformY >= ZBuffer[stripe]) continue;
+
+            for (int y = startY; y < startY + size; y++) {
+                if (y >= 0 && y < SSD1306_HEIGHT) SetPixel(stripe, y, 1);
+            }
+        }
+    }
+}
 
-            // Safety clamp
-            if(texX < 0) texX = 0;
-            if(texX > 15) texX = 15;
+//
+// Particles are single dots (PARTICLE_MAX_DOT square up close) at their own
+// height, so unlike the billboards each one costs a projection and a handful
+// of pixel writes. Reads the pool directly: no copy, nothing to interpolate.
+//
+void Render_Particles(const Camera_t *cam, const ParticlePool_t *pool)
+{
+    float invDet = 1.0f / (cam->plane_x * cam->dir_y - cam->dir_x * cam->plane_y);
+    const float scale = 1.0f / PARTICLE_ONE;
 
-            // Z-BUFFER CHECK
-            if(transformY < ZBuffer[stripe])
-            {
-                for(int y = drawStartY; y < drawEndY; y++)
-                {
-                    // Calculate Y coordinate on texture (0-15)
-                    // Math: (CurrentY - StartY) * TexHeight / TotalHeight
-                    int d = (y) * 256 - SSD1306_HEIGHT * 128 + spriteHeight * 128;
-                    int texY = ((d * 16) / spriteHeight) / 256;
-
-                    if(texY < 0) texY = 0;
-                    if(texY > 15) texY = 15;
-
-                    // Read the bit from the sprite array
-                    // We shift 1 by (15 - texX) because bit 15 is the leftmost pixel
-                    uint16_t color = (EnemySprite[texY] >> (15 - texX)) & 1;
-
-                    // Draw only if the pixel is White (1)
-                    // (Leave 0 as transparent so we see walls behind legs/arms)
-                    if(color != 0) {
-                        SetPixel(stripe, y, 1);
-                    }
-                }
+    for (uint32_t bits = pool->active; bits; bits &= bits - 1)
+    {
+        int i = __builtin_ctz(bits);
+
+        float spriteX = pool->x[i] * scale - cam->x;
+        float spriteY = pool->y[i] * scale - cam->y;
+
+        float transformX = invDet * (cam->dir_y * spriteX - cam->dir_x * spriteY);
+        float transformY = invDet * (-cam->plane_y * spriteX + cam->plane_x * spriteY);
+
+        if (transformY <= 0.1f) continue;
+
+        // A wall of height 1 spans SSD1306_HEIGHT / depth lines centred on eye level (0.5)
+        int screenX = (int)((SSD1306_WIDTH / 2) * (1 + transformX / transformY));
+        int screenY = (int)(SSD1306_HEIGHT / 2 - (pool->z[i] * scale - 0.5f) * SSD1306_HEIGHT / transformY);
+        int dot = (transformY < 2.0f) ? PARTICLE_MAX_DOT : 1;
+
+        for (int px = screenX; px < screenX + dot; px++)
+        {
+            if (px < 0 || px >= SSD1306_WIDTH) continue;
+            if (transformY >= ZBuffer[px]) continue;
+
+            for (int py = screenY; py < screenY + dot; py++) {
+                SetPixel(px, py, 1);    // Clips off-screen rows itself
             }
         }
     }
 }
+
+//
+// Rotates the view direction and camera plane together (keeps FOV constant)
+//
+void Camera_Rotate(Camera_t *cam, float angle)
+{
+    float s = sinf(angle);
+    float c = cosf(angle);
+
+    float oldDirX = cam->dir_x;
+    cam->dir_x = cam->dir_x * c - cam->dir_y * s;
+    cam->dir_y = oldDirX * s + cam->dir_y * c;
+
+    float oldPlaneX = cam->plane_x;
+    cam->plane_x = cam->plane_x * c - cam->plane_y * s;
+    cam->plane_y = oldPlaneX * s + cam->plane_y * c;
+}
@@ -0,0 +1,155 @@
+/* oem/src/Engine/renderState.c */
+#include "renderState.h"
+#include "gameLogic.h"
+#include "timing.h"
+#include <math.h>
+
+static PoseFrame_t prev_pose;
+static PoseFrame_t cur_pose;
+static uint8_t     pose_count = 0;  // 0 = empty, 1 = cur only, 2 = prev + cur
+static int         pose_level = -1;
+static RenderStateStats_t stats;
+
+static void CapturePose(PoseFrame_t *pose)
+{
+    Game_GetCamera(&pose->camera);
+
+    const EntityStore_t *ents = &Game.entities;
+    for (int i = 0; i < RENDER_MAX_SPRITES; i++) {
+        pose->sprites[i].active = 0;
+    }
+    ENTITY_FOREACH(ents, i) {
+        pose->sprites[i].x = ents->x[i];
+        pose->sprites[i].y = ents->y[i];
+        pose->sprites[i].active = 1;
+    }
+
+    const ProjectilePool_t *pool = &Game.projectiles;
+    for (int i = 0; i < PROJECTILE_CAPACITY; i++) {
+        pose->shots[i].x = pool->x[i];
+        pose->shots[i].y = pool->y[i];
+        pose->shots[i].active = (pool->active >> i) & 1;
+    }
+
+    const Player_t *other = Session.local_player ? &Game.player : &Game.partner;
+    pose->ally.x = other->x;
+    pose->ally.y = other->y;
+    pose->ally.active = Game.linked && other->health > 0;
+
+    pose->tick = Game.tick;
+    pose->stamp = Timing_Now();
+}
+
+void RenderState_Reset(void)
+{
+    pose_count = 0;
+    pose_level = -1;
+}
+
+void RenderState_Publish(void)
+{
+    // A new level or a gap in the tick sequence is a teleport: don't blend across it
+    if (pose_count && (Game.current_level_idx != pose_level || Game.tick != cur_pose.tick + 1)) {
+        pose_count = 0;
+    }
+
+    prev_pose = cur_pose;
+    CapturePose(&cur_pose);
+    pose_level = Game.current_level_idx;
+
+    if (pose_count < 2) pose_count++;
+    if (pose_count == 1) prev_pose = cur_pose;
+}
+
+static float Lerp(float a, float b, float t)
+{
+    return a + (b - a) * t;
+}
+
+static void BlendSprites(const SpritePos_t *a, const SpritePos_t *b, SpritePos_t *out, int count, float t)
+{
+    for (int i = 0; i < count; i++) {
+        out[i] = b[i];
+
+        // Only blend a slot that was live in both ticks (respawns snap)
+        if (a[i].active && b[i].active) {
+            out[i].x = Lerp(a[i].x, b[i].x, t);
+            out[i].y = Lerp(a[i].y, b[i].y, t);
+        }
+    }
+}
+
+//
+// Blends prev -> cur for a frame whose poses are read at 'sample_time' (DWT,
+// under gameMutex). The frame is drawn one logic tick behind that: the newest
+// tick was published at most a tick ago, so in steady state the target lies
+// between the two published ticks and nothing needs to be extrapolated.
+//
+int RenderState_Interpolate(uint32_t sample_time, Camera_t *cam, SpritePos_t *sprites,
+                            SpritePos_t *shots, SpritePos_t *ally)
+{
+    if (pose_count == 0) {
+        // Nothing published since the reset: draw the live state as-is
+        PoseFrame_t now;
+        CapturePose(&now);
+        *cam = now.camera;
+        for (int i = 0; i < RENDER_MAX_SPRITES; i++) sprites[i] = now.sprites[i];
+        for (int i = 0; i < PROJECTILE_CAPACITY; i++) shots[i] = now.shots[i];
+        *ally = now.ally;
+        return 0;
+    }
+
+    float t = 1.0f;
+
+#if RENDER_INTERP_ENABLE
+    uint32_t span = cur_pose.stamp - prev_pose.stamp;
+    if (span) {
+        uint32_t target = sample_time - Timing_UsToCycles(LOGIC_TICK_MS * 1000u);
+        int32_t into = (int32_t)(target - prev_pose.stamp);
+
+        if (into <= 0) t = 0.0f;
+        else if ((uint32_t)into < span) t = (float)into / (float)span;
+    }
+#endif
+
+    if (t <= 0.0f) stats.clamped++;
+    else if (t >= 1.0f) stats.held++;
+    else stats.blended++;
+
+    const Camera_t *a = &prev_pose.camera;
+    const Camera_t *b = &cur_pose.camera;
+
+    cam->x = Lerp(a->x, b->x, t);
+    cam->y = Lerp(a->y, b->y, t);
+
+    // nlerp: blend the facing, renormalise, then rebuild the plane at its current length
+    float dx = Lerp(a->dir_x, b->dir_x, t);
+    float dy = Lerp(a->dir_y, b->dir_y, t);
+    float len = sqrtf(dx * dx + dy * dy);
+    float plane_len = sqrtf(b->plane_x * b->plane_x + b->plane_y * b->plane_y);
+
+    if (len > 1e-4f) {
+        cam->dir_x = dx / len;
+        cam->dir_y = dy / len;
+        cam->plane_x = -cam->dir_y * plane_len;
+        cam->plane_y =  cam->dir_x * plane_len;
+    }
+    else {
+        // Half-turn in one tick: no meaningful midpoint, show the newest facing
+        cam->dir_x = b->dir_x;
+        cam->dir_y = b->dir_y;
+        cam->plane_x = b->plane_x;
+        cam->plane_y = b->plane_y;
+    }
+
+    BlendSprites(prev_pose.sprites, cur_pose.sprites, sprites, RENDER_MAX_SPRITES, t);
+    BlendSprites(prev_pose.shots, cur_pose.shots, shots, PROJECTILE_CAPACITY, t);
+    BlendSprites(&prev_pose.ally, &cur_pose.ally, ally, 1, t);
+
+    return 1;
+}
+
+void RenderState_GetStats(RenderStateStats_t *out)
+{
+    *out = stats;
+}
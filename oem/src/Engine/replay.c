@@ -0,0 +1,366 @@
+/* oem/src/Engine/replay.c */
+#include "replay.h"
+#include "aiScheduler.h"
+#include <string.h>
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+#else
+#include "main.h"
+extern UART_HandleTypeDef huart2;
+#endif
+
+//
+// Stream Encoding (one control byte, then optional payload)
+//   1nnnnnnn              : previous tick repeated n times (n = 1..127)
+//   01xxxyyy              : small axis delta (x,y in -4..+3), same flags
+//   000g0mmm + payload    : literal; m bit0 = X, bit1 = Y, bit2 = flags, g = governor (1 byte each)
+//   00001000 + 4 bytes    : state hash checkpoint (not a tick)
+//   00100000 + 1 byte     : the AI budget stopped the tick just recorded after
+//                           n round-robin thinks (precedes that tick's checkpoint)
+//
+#define CTRL_REPEAT         0x80
+#define CTRL_DELTA          0x40
+#define CTRL_HASH           0x08
+#define CTRL_AI_STOP        0x20
+#define LIT_X               0x01
+#define LIT_Y               0x02
+#define LIT_FLAGS           0x04
+#define LIT_GOV             0x10
+
+// Worst case for one tick: repeat flush + literal (5) + AI stop (2) + hash checkpoint (5)
+#define TICK_WORST_BYTES    13
+
+static uint8_t        stream[REPLAY_BUFFER_SIZE];
+static ReplayHeader_t header;
+static ReplayStatus_t status = { REPLAY_IDLE, 0, 0, 0, 0, 0 };
+static uint8_t        have_recording = 0;
+
+// Codec state (shared by recorder and player)
+static uint32_t pos = 0;
+static uint8_t  repeat = 0;     // Recorder: pending repeats / Player: repeats left
+static int8_t   cur_x = 0, cur_y = 0;
+static uint8_t  cur_flags = 0;
+static uint8_t  cur_gov = 0;
+
+// ==================== Quantisation ====================
+
+static int8_t QuantAxis(float v)
+{
+    int q = (int)(v * 127.0f + (v >= 0.0f ? 0.5f : -0.5f));
+    if (q > 127) q = 127;
+    if (q < -127) q = -127;
+    return (int8_t)q;
+}
+
+static uint8_t PackFlags(const InputSnapshot_t *in)
+{
+    uint8_t presses = in->fire_presses > 3 ? 3 : in->fire_presses;
+    uint8_t releases = in->fire_releases > 3 ? 3 : in->fire_releases;
+    return (in->fire_held & 0x1) | (presses << 1) | (releases << 3);
+}
+
+// Governor limits: cap in bits 0-4, spawn interval in bits 5-7
+static uint8_t PackGov(const InputSnapshot_t *in)
+{
+    uint8_t cap = in->entity_cap > 31 ? 31 : in->entity_cap;
+    uint8_t interval = in->spawn_interval > 7 ? 7 : in->spawn_interval;
+    return cap | (interval << 5);
+}
+
+// Rebuilds the snapshot the simulation sees from the quantised values
+static void ApplyQuantised(InputSnapshot_t *in)
+{
+    in->x = cur_x / 127.0f;
+    in->y = cur_y / 127.0f;
+    in->fire_held = cur_flags & 0x1;
+    in->fire_presses = (cur_flags >> 1) & 0x3;
+    in->fire_releases = (cur_flags >> 3) & 0x3;
+    in->entity_cap = cur_gov & 0x1F;
+    in->spawn_interval = cur_gov >> 5;
+}
+
+static void ResetCodec(void)
+{
+    pos = 0;
+    repeat = 0;
+    cur_x = 0;
+    cur_y = 0;
+    cur_flags = 0;
+    cur_gov = 0;
+}
+
+// ==================== Recording ====================
+
+static void FlushRepeats(void)
+{
+    if (repeat) {
+        stream[pos++] = CTRL_REPEAT | repeat;
+        repeat = 0;
+    }
+}
+
+void Replay_StartRecording(GameMode_t mode, uint32_t seed)
+{
+    ResetCodec();
+    memset(&header, 0, sizeof(header));
+    header.magic = REPLAY_MAGIC;
+    header.version = REPLAY_FORMAT_VERSION;
+    header.mode = (uint8_t)mode;
+    header.seed = seed;
+
+    status.mode = REPLAY_RECORDING;
+    status.ticks = 0;
+    status.bytes_used = 0;
+    status.overflowed = 0;
+    status.verified = 0;
+    status.first_mismatch = 0;
+    have_recording = 0;
+}
+
+void Replay_StopRecording(void)
+{
+    if (status.mode != REPLAY_RECORDING) return;
+
+    FlushRepeats();
+    header.ticks = status.ticks;
+    header.final_hash = Game_StateHash();
+    header.data_len = pos;
+
+    status.bytes_used = pos;
+    status.mode = REPLAY_IDLE;
+    have_recording = 1;
+}
+
+static void RecordTick(InputSnapshot_t *input)
+{
+    if (pos + TICK_WORST_BYTES > REPLAY_BUFFER_SIZE) {
+        // Out of space: close the recording at the last complete tick
+        status.overflowed = 1;
+        Replay_StopRecording();
+        return;
+    }
+
+    int8_t qx = QuantAxis(input->x);
+    int8_t qy = QuantAxis(input->y);
+    uint8_t flags = PackFlags(input);
+    uint8_t gov = PackGov(input);
+
+    if (qx == cur_x && qy == cur_y && flags == cur_flags && gov == cur_gov) {
+        if (++repeat == 0x7F) FlushRepeats();
+    }
+    else {
+        int dx = qx - cur_x;
+        int dy = qy - cur_y;
+
+        FlushRepeats();
+        if (flags == cur_flags && gov == cur_gov && dx >= -4 && dx <= 3 && dy >= -4 && dy <= 3) {
+            stream[pos++] = CTRL_DELTA | ((dx + 4) << 3) | (dy + 4);
+        }
+        else {
+            uint8_t mask = 0;
+            uint32_t ctrl = pos++;
+            if (qx != cur_x)       { mask |= LIT_X;     stream[pos++] = (uint8_t)qx; }
+            if (qy != cur_y)       { mask |= LIT_Y;     stream[pos++] = (uint8_t)qy; }
+            if (flags != cur_flags){ mask |= LIT_FLAGS; stream[pos++] = flags; }
+            if (gov != cur_gov)    { mask |= LIT_GOV;   stream[pos++] = gov; }
+            stream[ctrl] = mask;
+        }
+        cur_x = qx;
+        cur_y = qy;
+        cur_flags = flags;
+        cur_gov = gov;
+    }
+
+    // The simulation must see exactly what a playback will reproduce
+    ApplyQuantised(input);
+}
+
+// ==================== Playback ====================
+
+int Replay_StartPlayback(GameMode_t *mode, uint32_t *seed)
+{
+    if (!have_recording || status.mode != REPLAY_IDLE) return 0;
+
+    ResetCodec();
+    *mode = (GameMode_t)header.mode;
+    *seed = header.seed;
+
+    status.mode = REPLAY_PLAYING;
+    status.ticks = 0;
+    status.bytes_used = header.data_len;
+    status.verified = 0;
+    status.first_mismatch = 0;
+    return 1;
+}
+
+void Replay_StopPlayback(void)
+{
+    if (status.mode == REPLAY_PLAYING) status.mode = REPLAY_IDLE;
+}
+
+static void DecodeTick(void)
+{
+    if (repeat) {
+        repeat--;
+        return;
+    }
+
+    while (pos < header.data_len)
+    {
+        uint8_t ctrl = stream[pos++];
+
+        if (ctrl & CTRL_REPEAT) {
+            repeat = (ctrl & 0x7F) - 1; // This tick consumes one of them
+            return;
+        }
+        if (ctrl & CTRL_DELTA) {
+            cur_x += ((ctrl >> 3) & 0x7) - 4;
+            cur_y += (ctrl & 0x7) - 4;
+            return;
+        }
+        if (ctrl == CTRL_HASH) {
+            pos += 4; // Checkpoint out of place (normally consumed by EndTick)
+            continue;
+        }
+        if (ctrl == CTRL_AI_STOP) {
+            pos += 1; // Likewise (normally consumed by BeginTick)
+            continue;
+        }
+        if (ctrl & LIT_X)     cur_x = (int8_t)stream[pos++];
+        if (ctrl & LIT_Y)     cur_y = (int8_t)stream[pos++];
+        if (ctrl & LIT_FLAGS) cur_flags = stream[pos++];
+        if (ctrl & LIT_GOV)   cur_gov = stream[pos++];
+        return;
+    }
+}
+
+static void CheckHash(uint32_t expected)
+{
+    if (expected != Game_StateHash() && status.first_mismatch == 0) {
+        status.first_mismatch = status.ticks;
+    }
+}
+
+// ==================== Per-Tick Hooks ====================
+
+int Replay_BeginTick(InputSnapshot_t *input)
+{
+    if (status.mode == REPLAY_RECORDING) {
+        RecordTick(input);
+    }
+    else if (status.mode == REPLAY_PLAYING) {
+        if (status.ticks >= header.ticks) {
+            status.mode = REPLAY_IDLE;
+            return 0;
+        }
+        DecodeTick();
+        ApplyQuantised(input);
+
+        // The last tick of a run is the one an AI stop recorded after it belongs to
+        if (repeat == 0 && pos + 2 <= header.data_len && stream[pos] == CTRL_AI_STOP) {
+            AiSched_LimitNextRun(stream[pos + 1]);
+            pos += 2;
+        }
+    }
+    return 1;
+}
+
+void Replay_EndTick(void)
+{
+    if (status.mode == REPLAY_RECORDING) {
+        uint8_t stop = AiSched_TakeBudgetStop();
+        if (stop != AI_SCHED_NO_STOP) {
+            FlushRepeats();
+            stream[pos++] = CTRL_AI_STOP;
+            stream[pos++] = stop;
+        }
+
+        status.ticks++;
+        if (status.ticks % REPLAY_HASH_INTERVAL == 0) {
+            uint32_t h = Game_StateHash();
+            FlushRepeats();
+            stream[pos++] = CTRL_HASH;
+            memcpy(&stream[pos], &h, 4);
+            pos += 4;
+        }
+        status.bytes_used = pos;
+    }
+    else if (status.mode == REPLAY_PLAYING) {
+        status.ticks++;
+
+        // A checkpoint written after this tick sits right here in the stream
+        if (repeat == 0 && pos + 5 <= header.data_len && stream[pos] == CTRL_HASH) {
+            uint32_t h;
+            memcpy(&h, &stream[pos + 1], 4);
+            pos += 5;
+            CheckHash(h);
+        }
+
+        if (status.ticks == header.ticks) {
+            CheckHash(header.final_hash);
+            status.verified = (status.first_mismatch == 0);
+        }
+    }
+}
+
+ReplayMode_t Replay_GetMode(void)
+{
+    return status.mode;
+}
+
+void Replay_GetStatus(ReplayStatus_t *out)
+{
+    *out = status;
+}
+
+// ==================== Export / Import ====================
+
+#ifndef HOST_BUILD
+int Replay_ExportUart(void)
+{
+    if (!have_recording) return 0;
+
+    if (HAL_UART_Transmit(&huart2, (const uint8_t*)&header, sizeof(header), 100) != HAL_OK) return 0;
+
+    // HAL length is 16-bit; send the stream in chunks
+    for (uint32_t off = 0; off < header.data_len; off += 4096) {
+        uint32_t len = header.data_len - off;
+        if (len > 4096) len = 4096;
+        if (HAL_UART_Transmit(&huart2, &stream[off], (uint16_t)len, 1000) != HAL_OK) return 0;
+    }
+    return 1;
+}
+#else
+int Replay_LoadFile(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) return 0;
+
+    ReplayHeader_t h;
+    int ok = (fread(&h, sizeof(h), 1, f) == 1) &&
+             h.magic == REPLAY_MAGIC && h.version == REPLAY_FORMAT_VERSION &&
+             h.data_len <= REPLAY_BUFFER_SIZE &&
+             fread(stream, 1, h.data_len, f) == h.data_len;
+    fclose(f);
+
+    if (!ok) return 0;
+    header = h;
+    have_recording = 1;
+    status.mode = REPLAY_IDLE;
+    return 1;
+}
+
+int Replay_SaveFile(const char *path)
+{
+    if (!have_recording) return 0;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return 0;
+
+    int ok = (fwrite(&header, sizeof(header), 1, f) == 1) &&
+             fwrite(stream, 1, header.data_len, f) == header.data_len;
+    fclose(f);
+    return ok;
+}
+#endif
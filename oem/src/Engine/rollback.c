@@ -0,0 +1,110 @@
+/* oem/src/Engine/rollback.c */
+#include "rollback.h"
+#include "appConfig.h"
+#include "effects.h"
+#include "timing.h"
+#include <string.h>
+
+#if ENABLE_ROLLBACK
+
+#define ROLLBACK_MASK   (ROLLBACK_DEPTH - 1)
+
+// Frame for tick t lives in slot t & ROLLBACK_MASK
+static RollbackFrame_t frames[ROLLBACK_DEPTH];
+static uint32_t newest = 0;     // Tick of the newest save point
+static uint8_t  held = 0;       // Consecutive save points ending at 'newest'
+static RollbackStats_t rb_stats = { .bytes_per_tick = sizeof(RollbackFrame_t) };
+
+void Rollback_Reset(void)
+{
+    held = 0;
+}
+
+void Rollback_SaveTick(const InputSnapshot_t *input)
+{
+    uint32_t start = Timing_Now();
+    uint32_t tick = Game.tick;
+
+    // Not the tick after the newest save point: the chain restarts here
+    if (held && tick != newest + 1) held = 0;
+
+    RollbackFrame_t *f = &frames[tick & ROLLBACK_MASK];
+    f->input = *input;
+    memcpy(&f->state, &Game, sizeof(GameState_t));
+
+    newest = tick;
+    if (held < ROLLBACK_DEPTH) held++;
+
+    rb_stats.saves++;
+    rb_stats.save_cycles = Timing_Now() - start;
+}
+
+int Rollback_Holds(uint32_t tick)
+{
+    return held && (newest - tick) < held;
+}
+
+int Rollback_SetInput(uint32_t tick, const InputSnapshot_t *input)
+{
+    if (!Rollback_Holds(tick)) return 0;
+
+    frames[tick & ROLLBACK_MASK].input = *input;
+    return 1;
+}
+
+int Rollback_Restore(uint32_t tick)
+{
+    if (!Rollback_Holds(tick)) return 0;
+
+    uint32_t start = Timing_Now();
+    const GameState_t *saved = &frames[tick & ROLLBACK_MASK].state;
+
+    // Walls, PVS and spawn cells are level tables outside Game
+    if (saved->current_level_idx != Game.current_level_idx) {
+        Game_PrepareLevel(saved->current_level_idx);
+    }
+    memcpy(&Game, saved, sizeof(GameState_t));
+
+    // 'tick' is about to run again and saves itself; its old slot keeps the input
+    held -= (uint8_t)(newest - tick + 1);
+    newest = tick - 1;
+
+    rb_stats.restores++;
+    rb_stats.restore_cycles = Timing_Now() - start;
+    return 1;
+}
+
+//
+// Rewinds to the start of 'tick' and steps forward through every stored input
+// up to where the run was. Feedback from these ticks was already shown once,
+// so effects are muted while they run again.
+//
+int Rollback_Resimulate(uint32_t tick)
+{
+    if (!Rollback_Holds(tick)) return 0;
+
+    uint32_t start = Timing_Now();
+    uint32_t end = newest + 1;
+
+    Rollback_Restore(tick);
+
+    Effects_SetMuted(1);
+    for (uint32_t t = tick; t != end; t++) {
+        InputSnapshot_t input = frames[t & ROLLBACK_MASK].input;
+        Rollback_SaveTick(&input);
+        Game_Tick(&input);
+    }
+    Effects_SetMuted(0);
+
+    rb_stats.resim_ticks = end - tick;
+    rb_stats.resim_cycles = Timing_Now() - start;
+    rb_stats.resim_tick_cycles = rb_stats.resim_cycles / rb_stats.resim_ticks;
+    return 1;
+}
+
+void Rollback_GetStats(RollbackStats_t *stats)
+{
+    *stats = rb_stats;
+}
+
+#endif /* ENABLE_ROLLBACK */
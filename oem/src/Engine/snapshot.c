@@ -0,0 +1,310 @@
+/* oem/src/Engine/snapshot.c */
+#include "snapshot.h"
+#include "flashStore.h"
+#include "appConfig.h"
+#include "levels.h"
+#include "crc32.h"
+#include "timing.h"
+#include <string.h>
+
+#define SNAPSHOT_RAM_SLOTS      2
+
+// Not zeroed at boot: whatever the previous run left here is checked by CRC
+static SnapshotImage_t ram_images[SNAPSHOT_RAM_SLOTS] __attribute__((section(".noinit")));
+
+static SnapshotImage_t flash_image;     // Staging copy of the flash record
+static uint32_t        save_seq = 0;
+static SnapshotStats_t snap_stats;
+
+//
+// Bounded byte cursor: any overrun clears 'ok' and every later access is a no-op
+//
+typedef struct {
+    uint8_t *buf;
+    uint16_t pos;
+    uint16_t cap;
+    uint8_t  ok;
+} Cursor_t;
+
+static void Put(Cursor_t *c, const void *src, uint16_t n)
+{
+    if (!c->ok || c->pos + n > c->cap) { c->ok = 0; return; }
+    memcpy(c->buf + c->pos, src, n);
+    c->pos += n;
+}
+
+static void Get(Cursor_t *c, void *dst, uint16_t n)
+{
+    if (!c->ok || c->pos + n > c->cap) { c->ok = 0; memset(dst, 0, n); return; }
+    memcpy(dst, c->buf + c->pos, n);
+    c->pos += n;
+}
+
+static void Put8(Cursor_t *c, uint8_t v)  { Put(c, &v, 1); }
+static void Put16(Cursor_t *c, int16_t v) { Put(c, &v, 2); }
+
+static uint8_t Get8(Cursor_t *c)  { uint8_t v;  Get(c, &v, 1); return v; }
+static int16_t Get16(Cursor_t *c) { int16_t v;  Get(c, &v, 2); return v; }
+
+//
+// Payload layout (native endianness: an image is only read back by the same build)
+//
+static uint16_t Serialise(uint8_t *buf)
+{
+    Cursor_t c = { buf, 0, SNAPSHOT_MAX_PAYLOAD, 1 };
+    const EntityStore_t *ents = &Game.entities;
+    const ProjectilePool_t *pool = &Game.projectiles;
+
+    Put8(&c, (uint8_t)Game.state);
+    Put8(&c, (uint8_t)Game.mode);
+    Put8(&c, (uint8_t)Game.current_level_idx);
+    Put8(&c, Game.ai_cursor);
+    Put8(&c, ENTITY_CAPACITY);
+    Put8(&c, PROJECTILE_CAPACITY);
+
+    Put(&c, &Game.player.x, sizeof(float));
+    Put(&c, &Game.player.y, sizeof(float));
+    Put(&c, &Game.player.dir_x, sizeof(float));
+    Put(&c, &Game.player.dir_y, sizeof(float));
+    Put(&c, &Game.player.plane_x, sizeof(float));
+    Put(&c, &Game.player.plane_y, sizeof(float));
+    Put16(&c, (int16_t)Game.player.health);
+    Put16(&c, (int16_t)Game.transition_timer);
+
+    Put(&c, &Game.current_score, sizeof(uint32_t));
+    Put(&c, &Game.rng_seed, sizeof(uint32_t));
+    Put(&c, &Game.rng_state, sizeof(uint32_t));
+    Put(&c, &Game.tick, sizeof(uint32_t));
+
+    // Live enemies only
+    Put(&c, ents->active, sizeof(ents->active));
+    ENTITY_FOREACH(ents, i) {
+        Put(&c, &ents->x[i], sizeof(float));
+        Put(&c, &ents->y[i], sizeof(float));
+        Put16(&c, ents->health[i]);
+        Put8(&c, ents->type[i]);
+        Put8(&c, ents->state[i]);
+        Put(&c, &ents->think_tick[i], sizeof(uint32_t));
+        Put(&c, &ents->fire_tick[i], sizeof(uint32_t));
+    }
+
+    // Live projectiles only
+    Put(&c, &pool->active, sizeof(uint32_t));
+    for (uint32_t bits = pool->active; bits; bits &= bits - 1) {
+        int i = __builtin_ctz(bits);
+        Put(&c, &pool->x[i], sizeof(float));
+        Put(&c, &pool->y[i], sizeof(float));
+        Put(&c, &pool->vx[i], sizeof(float));
+        Put(&c, &pool->vy[i], sizeof(float));
+        Put(&c, &pool->ttl[i], sizeof(uint16_t));
+    }
+
+    return c.ok ? c.pos : 0;
+}
+
+//
+// Rebuilds Game from a payload whose CRC already matched. Contents are still
+// range-checked: a bad index must not reach the level tables. On 0 Game is
+// partially written and the caller must Game_Init.
+//
+static int Deserialise(const uint8_t *buf, uint16_t len)
+{
+    Cursor_t c = { (uint8_t *)buf, 0, len, 1 };
+    EntityStore_t *ents = &Game.entities;
+    ProjectilePool_t *pool = &Game.projectiles;
+
+    uint8_t state = Get8(&c);
+    uint8_t mode = Get8(&c);
+    uint8_t level = Get8(&c);
+    uint8_t cursor = Get8(&c);
+    uint8_t entity_cap = Get8(&c);
+    uint8_t projectile_cap = Get8(&c);
+
+    if (!c.ok) return 0;
+    if (state != STATE_PLAYING && state != STATE_LEVEL_TRANSITION) return 0;
+    if (mode != MODE_CLASSIC && mode != MODE_ARCADE) return 0;
+    if (level >= TOTAL_LEVELS || cursor >= ENTITY_CAPACITY) return 0;
+    if (entity_cap != ENTITY_CAPACITY || projectile_cap != PROJECTILE_CAPACITY) return 0;
+
+    Game.state = (SceneState_t)state;
+    Game.mode = (GameMode_t)mode;
+    Game.ai_cursor = cursor;
+
+    Get(&c, &Game.player.x, sizeof(float));
+    Get(&c, &Game.player.y, sizeof(float));
+    Get(&c, &Game.player.dir_x, sizeof(float));
+    Get(&c, &Game.player.dir_y, sizeof(float));
+    Get(&c, &Game.player.plane_x, sizeof(float));
+    Get(&c, &Game.player.plane_y, sizeof(float));
+    Game.player.health = Get16(&c);
+    Game.transition_timer = Get16(&c);
+
+    Get(&c, &Game.current_score, sizeof(uint32_t));
+    Get(&c, &Game.rng_seed, sizeof(uint32_t));
+    Get(&c, &Game.rng_state, sizeof(uint32_t));
+    Get(&c, &Game.tick, sizeof(uint32_t));
+
+    Entity_Clear(ents);
+    Get(&c, ents->active, sizeof(ents->active));
+#if ENTITY_CAPACITY % 32
+    if (ents->active[ENTITY_MASK_WORDS - 1] >> (ENTITY_CAPACITY % 32)) return 0;
+#endif
+    ENTITY_FOREACH(ents, i) {
+        Get(&c, &ents->x[i], sizeof(float));
+        Get(&c, &ents->y[i], sizeof(float));
+        ents->health[i] = Get16(&c);
+        ents->type[i] = Get8(&c);
+        ents->state[i] = Get8(&c);
+        Get(&c, &ents->think_tick[i], sizeof(uint32_t));
+        Get(&c, &ents->fire_tick[i], sizeof(uint32_t));
+        ents->count++;
+    }
+
+    Projectile_Clear(pool);
+    Get(&c, &pool->active, sizeof(uint32_t));
+#if PROJECTILE_CAPACITY < 32
+    if (pool->active >> PROJECTILE_CAPACITY) return 0;
+#endif
+    for (uint32_t bits = pool->active; bits; bits &= bits - 1) {
+        int i = __builtin_ctz(bits);
+        Get(&c, &pool->x[i], sizeof(float));
+        Get(&c, &pool->y[i], sizeof(float));
+        Get(&c, &pool->vx[i], sizeof(float));
+        Get(&c, &pool->vy[i], sizeof(float));
+        Get(&c, &pool->ttl[i], sizeof(uint16_t));
+        pool->count++;
+    }
+
+    // Every byte consumed, nothing more
+    if (!c.ok || c.pos != len) return 0;
+
+    // Derived state: level tables, spatial buckets, per-boot fields
+    Game_PrepareLevel(level);
+    Spatial_Clear(&Game.grid);
+    ENTITY_FOREACH(ents, i) {
+        Spatial_Insert(&Game.grid, i, ents->x[i], ents->y[i]);
+    }
+    Game.high_score = LoadHighScore();
+    if (Game.current_score > Game.high_score) Game.high_score = Game.current_score;
+    Session.input_timestamp = 0;
+
+    return 1;
+}
+
+static int IsValid(const SnapshotImage_t *img)
+{
+    const SnapshotHeader_t *h = &img->header;
+
+    return h->magic == SNAPSHOT_MAGIC &&
+           h->build == SNAPSHOT_BUILD_ID &&
+           h->format == SNAPSHOT_FORMAT_VERSION &&
+           h->length <= SNAPSHOT_MAX_PAYLOAD &&
+           Crc32(img->payload, h->length) == h->crc;
+}
+
+static const SnapshotImage_t *NewestRamImage(void)
+{
+    const SnapshotImage_t *best = NULL;
+
+    for (int s = 0; s < SNAPSHOT_RAM_SLOTS; s++) {
+        if (!IsValid(&ram_images[s])) continue;
+        if (!best || (int32_t)(ram_images[s].header.seq - best->header.seq) > 0) best = &ram_images[s];
+    }
+    return best;
+}
+
+void Snapshot_SaveRam(void)
+{
+    uint32_t start = Timing_Now();
+
+    // Overwrite the older slot; the other stays valid if we're reset mid-write
+    SnapshotImage_t *img = &ram_images[(save_seq + 1) % SNAPSHOT_RAM_SLOTS];
+    img->header.magic = 0;
+
+    uint16_t len = Serialise(img->payload);
+    if (len == 0) return;
+
+    save_seq++;
+    img->header.build = SNAPSHOT_BUILD_ID;
+    img->header.format = SNAPSHOT_FORMAT_VERSION;
+    img->header.length = len;
+    img->header.seq = save_seq;
+    img->header.crc = Crc32(img->payload, len);
+    img->header.magic = SNAPSHOT_MAGIC;     // Last: the image counts from here on
+
+    snap_stats.saves++;
+    snap_stats.bytes = len;
+    snap_stats.save_cycles = Timing_Now() - start;
+}
+
+void Snapshot_MirrorToFlash(void)
+{
+    const SnapshotImage_t *img = NewestRamImage();
+    if (!img) return;
+
+    // A full sector would erase under the running game; the RAM images still cover a reset
+    uint16_t len = sizeof(SnapshotHeader_t) + img->header.length;
+    if (!FlashStore_Fits(len)) {
+        snap_stats.mirrors_skipped++;
+        return;
+    }
+
+    FlashStore_Write(FS_KEY_SNAPSHOT, img, len);
+    snap_stats.mirrors++;
+}
+
+void Snapshot_Invalidate(void)
+{
+    static const uint8_t none = 0;
+
+    for (int s = 0; s < SNAPSHOT_RAM_SLOTS; s++) {
+        ram_images[s].header.magic = 0;
+    }
+    FlashStore_Write(FS_KEY_SNAPSHOT, &none, 0);
+}
+
+int Snapshot_Resume(void)
+{
+    uint32_t start = Timing_Now();
+    const SnapshotImage_t *img = NewestRamImage();
+    uint8_t source = 1;
+
+    if (!img) {
+        uint16_t len = sizeof(flash_image);
+        if (FlashStore_Read(FS_KEY_SNAPSHOT, &flash_image, &len) != FS_OK || len < sizeof(SnapshotHeader_t)) {
+            return 0;
+        }
+        if (len != sizeof(SnapshotHeader_t) + flash_image.header.length || !IsValid(&flash_image)) {
+            snap_stats.rejected++;
+            return 0;
+        }
+        img = &flash_image;
+        source = 2;
+    }
+
+    if (!Deserialise(img->payload, img->header.length)) {
+        snap_stats.rejected++;
+        return 0;
+    }
+
+    // Keep alternating from where the image left off
+    save_seq = img->header.seq;
+
+    snap_stats.resumed_from = source;
+    snap_stats.resume_us = Timing_CyclesToUs(Timing_Now() - start);
+    return 1;
+}
+
+void Snapshot_GetStats(SnapshotStats_t *stats)
+{
+    *stats = snap_stats;
+}
+
+#ifdef HOST_BUILD
+void Snapshot_PowerCycle(void)
+{
+    for (int s = 0; s < SNAPSHOT_RAM_SLOTS; s++) {
+        ram_images[s].header.magic = 0;
+    }
+}
+#endif
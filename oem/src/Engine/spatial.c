@@ -0,0 +1,98 @@
+/* oem/src/Engine/spatial.c */
+#include "spatial.h"
+#include <string.h>
+
+static uint8_t CellOf(float x, float y)
+{
+    int cx = (int)x, cy = (int)y;
+    if (cx < 0) cx = 0;
+    if (cx >= MAP_W) cx = MAP_W - 1;
+    if (cy < 0) cy = 0;
+    if (cy >= MAP_H) cy = MAP_H - 1;
+    return (uint8_t)(cx * MAP_H + cy);
+}
+
+void Spatial_Clear(SpatialIndex_t *grid)
+{
+    memset(grid, SPATIAL_NONE, sizeof(*grid));
+}
+
+static void Link(SpatialIndex_t *grid, int idx, uint8_t cell)
+{
+    uint8_t old_head = grid->head[cell];
+
+    grid->cell[idx] = cell;
+    grid->prev[idx] = SPATIAL_NONE;
+    grid->next[idx] = old_head;
+    if (old_head != SPATIAL_NONE) grid->prev[old_head] = (uint8_t)idx;
+    grid->head[cell] = (uint8_t)idx;
+}
+
+static void Unlink(SpatialIndex_t *grid, int idx)
+{
+    uint8_t p = grid->prev[idx];
+    uint8_t n = grid->next[idx];
+
+    if (p != SPATIAL_NONE) grid->next[p] = n;
+    else grid->head[grid->cell[idx]] = n;
+    if (n != SPATIAL_NONE) grid->prev[n] = p;
+
+    grid->cell[idx] = SPATIAL_NONE;
+}
+
+void Spatial_Insert(SpatialIndex_t *grid, int idx, float x, float y)
+{
+    if (grid->cell[idx] != SPATIAL_NONE) Unlink(grid, idx);
+    Link(grid, idx, CellOf(x, y));
+}
+
+void Spatial_Remove(SpatialIndex_t *grid, int idx)
+{
+    if (grid->cell[idx] != SPATIAL_NONE) Unlink(grid, idx);
+}
+
+void Spatial_Move(SpatialIndex_t *grid, int idx, float x, float y)
+{
+    uint8_t cell = CellOf(x, y);
+    if (cell == grid->cell[idx]) return;
+
+    if (grid->cell[idx] != SPATIAL_NONE) Unlink(grid, idx);
+    Link(grid, idx, cell);
+}
+
+int Spatial_QueryRadius(const SpatialIndex_t *grid, const EntityStore_t *ents,
+                        float x, float y, float radius, uint8_t *out, int max)
+{
+    int x0 = (int)(x - radius), x1 = (int)(x + radius);
+    int y0 = (int)(y - radius), y1 = (int)(y + radius);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= MAP_W) x1 = MAP_W - 1;
+    if (y1 >= MAP_H) y1 = MAP_H - 1;
+
+    float rSq = radius * radius;
+    int found = 0;
+
+    for (int cx = x0; cx <= x1; cx++) {
+        for (int cy = y0; cy <= y1; cy++) {
+            for (uint8_t i = grid->head[cx * MAP_H + cy]; i != SPATIAL_NONE; i = grid->next[i]) {
+                float dx = ents->x[i] - x;
+                float dy = ents->y[i] - y;
+                if (dx * dx + dy * dy >= rSq) continue;
+
+                if (found < max) out[found] = i;
+                found++;
+            }
+        }
+    }
+    return found;
+}
+
+int Spatial_CellCount(const SpatialIndex_t *grid, int cell_x, int cell_y)
+{
+    if (cell_x < 0 || cell_x >= MAP_W || cell_y < 0 || cell_y >= MAP_H) return 0;
+
+    int count = 0;
+    for (uint8_t i = grid->head[cell_x * MAP_H + cell_y]; i != SPATIAL_NONE; i = grid->next[i]) count++;
+    return count;
+}
@@ -0,0 +1,70 @@
+/* oem/src/Engine/spawn.c */
+#include "spawn.h"
+#include "rng.h"
+#include <stdlib.h> // abs()
+
+static uint8_t  free_cells[MAP_W * MAP_H];  // x * MAP_H + y of every open cell
+static uint16_t free_count = 0;
+static SpawnStats_t stats;
+
+void Spawn_LoadLevel(const Level_t *level)
+{
+    free_count = 0;
+    for (int x = 0; x < MAP_W; x++) {
+        for (int y = 0; y < MAP_H; y++) {
+            if (level->map[x][y] == 0) free_cells[free_count++] = (uint8_t)(x * MAP_H + y);
+        }
+    }
+}
+
+int Spawn_FreeCellCount(void)
+{
+    return free_count;
+}
+
+static int IsValid(const SpatialIndex_t *grid, uint8_t c, int player_cx, int player_cy)
+{
+    int x = c / MAP_H, y = c % MAP_H;
+
+    if (abs(x - player_cx) < SPAWN_MIN_PLAYER_CELLS && abs(y - player_cy) < SPAWN_MIN_PLAYER_CELLS) return 0;
+    return grid->head[c] == SPATIAL_NONE;
+}
+
+int Spawn_PickCell(uint32_t *rng, const SpatialIndex_t *grid, int player_cx, int player_cy,
+                   int *cell_x, int *cell_y)
+{
+    if (free_count == 0) return 0;
+
+    int found = 0;
+    uint8_t c = 0;
+
+    // Rejection sampling: uniform over the valid cells, O(1) while most are valid
+    for (int draw = 0; draw < SPAWN_MAX_DRAWS && !found; draw++) {
+        c = free_cells[Rng_Range(rng, free_count)];
+        found = IsValid(grid, c, player_cx, player_cy);
+        if (!found) stats.rejected_draws++;
+    }
+
+    // Crowded level: draw from the valid cells only
+    if (!found) {
+        uint8_t candidates[MAP_W * MAP_H];
+        uint16_t n = 0;
+
+        stats.full_scans++;
+        for (uint16_t i = 0; i < free_count; i++) {
+            if (IsValid(grid, free_cells[i], player_cx, player_cy)) candidates[n++] = free_cells[i];
+        }
+        if (n == 0) return 0;
+        c = candidates[Rng_Range(rng, n)];
+    }
+
+    stats.picks++;
+    *cell_x = c / MAP_H;
+    *cell_y = c % MAP_H;
+    return 1;
+}
+
+void Spawn_GetStats(SpawnStats_t *out)
+{
+    *out = stats;
+}
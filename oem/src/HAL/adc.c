@@ -5,44 +5,135 @@
 // External Handle from main.c
 extern ADC_HandleTypeDef hadc1;
 
+// Trigger timer owned by this driver (same pattern as I2C_Init owning I2C1)
+static TIM_HandleTypeDef htim3;
+
 // --- DMA Buffer ---
 // volatile tells the compiler that hardware modifies this memory.
-// uint16_t due to half word use
-volatile uint16_t adc_dma_buffer[2];
+// uint16_t due to half word use. Layout: [X0 Y0 X1 Y1 ...], two halves.
+volatile uint16_t adc_dma_buffer[ADC_BUFFER_LEN];
+
+// Half that most recently completed (0 = first, 1 = second), written from the DMA ISR
+static volatile uint8_t adc_ready_half = 0;
+
+// Thread woken by the half/full transfer callbacks
+static osThreadId_t adc_notify_thread = NULL;
+
+//
+// Configures TIM3 to emit TRGO at ADC_SCAN_RATE_HZ (ADC1 is set to start on T3_TRGO)
+//
+static void ADC_Trigger_Init(void)
+{
+    TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+    TIM_MasterConfigTypeDef sMasterConfig = {0};
+
+    __HAL_RCC_TIM3_CLK_ENABLE();
+
+    // APB1 timer clock = 84 MHz -> 1 MHz counter
+    htim3.Instance = TIM3;
+    htim3.Init.Prescaler = (SystemCoreClock / 1000000U) - 1;
+    htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim3.Init.Period = (1000000U / ADC_SCAN_RATE_HZ) - 1;
+    htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&htim3) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+    if (HAL_TIM_ConfigClockSource(&htim3, &sClockSourceConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
+    sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+    if (HAL_TIMEx_MasterConfigSynchronization(&htim3, &sMasterConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+}
 
 void ADC_Joystick_Init(void)
 {
-    // Initialize Button GPIO (Standard Input)
-    __HAL_RCC_GPIOA_CLK_ENABLE();
-    GPIO_InitTypeDef GPIO_InitStruct = {0};
-    GPIO_InitStruct.Pin = JOY_PIN_BUTTON;
-    GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
-    GPIO_InitStruct.Pull = GPIO_PULLUP;
-    HAL_GPIO_Init(JOY_PORT_BUTTON, &GPIO_InitStruct);
-
-    // The ADC will now run forever in the background, updating 'adc_dma_buffer'.
-    // We do NOT need a Mutex anymore because we are only READING from this buffer.
-    if (HAL_ADC_Start_DMA(&hadc1, (uint32_t*)adc_dma_buffer, 2) != HAL_OK)
+    // The fire button (PA10) is an EXTI input configured by MX_GPIO_Init; see button.c
+
+    // The calling thread receives ADC_FLAG_HALF / ADC_FLAG_FULL
+    adc_notify_thread = osThreadGetId();
+
+    ADC_Trigger_Init();
+
+    // The ADC now converts only when TIM3 fires, and DMA refills 'adc_dma_buffer'
+    // in the background. The CPU only touches a half after DMA has moved past it.
+    if (HAL_ADC_Start_DMA(&hadc1, (uint32_t*)adc_dma_buffer, ADC_BUFFER_LEN) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    if (HAL_TIM_Base_Start(&htim3) != HAL_OK)
     {
         Error_Handler();
     }
 }
 
-// DMA Getters
+//
+// DMA Transfer Callbacks (ADC/DMA ISR context, priority 5 -> RTOS-safe)
+//
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef* hadc)
+{
+    if (hadc->Instance != ADC1) return;
+
+    adc_ready_half = 0;
+    if (adc_notify_thread) osThreadFlagsSet(adc_notify_thread, ADC_FLAG_HALF);
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc)
+{
+    if (hadc->Instance != ADC1) return;
+
+    adc_ready_half = 1;
+    if (adc_notify_thread) osThreadFlagsSet(adc_notify_thread, ADC_FLAG_FULL);
+}
+
+//
+// Averages the most recently completed half-buffer (oversampling)
+// DMA is writing the other half meanwhile, so no locking is needed.
+//
+void ADC_ReadAveraged(uint16_t *x, uint16_t *y)
+{
+    const volatile uint16_t *block = &adc_dma_buffer[adc_ready_half * ADC_SCANS_PER_HALF * ADC_CHANNELS];
+    uint32_t sum_x = 0;
+    uint32_t sum_y = 0;
+
+    for (int i = 0; i < ADC_SCANS_PER_HALF; i++)
+    {
+        sum_x += block[i * ADC_CHANNELS + 0];
+        sum_y += block[i * ADC_CHANNELS + 1];
+    }
+
+    *x = (uint16_t)((sum_x + ADC_SCANS_PER_HALF / 2) / ADC_SCANS_PER_HALF);
+    *y = (uint16_t)((sum_y + ADC_SCANS_PER_HALF / 2) / ADC_SCANS_PER_HALF);
+}
+
+// Averaged Getters
 uint32_t ADC_GetX(void)
 {
-    // Returns the latest X value instantly from RAM
-    return adc_dma_buffer[0];
+    uint16_t x, y;
+    ADC_ReadAveraged(&x, &y);
+    return x;
 }
 
 uint32_t ADC_GetY(void)
 {
-    // Returns the latest Y value instantly from RAM
-    return adc_dma_buffer[1];
+    uint16_t x, y;
+    ADC_ReadAveraged(&x, &y);
+    return y;
 }
 
 uint8_t ADC_ReadButton(void)
 {
+    // Raw pin level, used by the EXTI debouncer (Button_IsHeld is the debounced state)
     // Returns 1 if Pressed (Active Low), 0 if Released
     return (HAL_GPIO_ReadPin(JOY_PORT_BUTTON, JOY_PIN_BUTTON) == GPIO_PIN_RESET) ? 1 : 0;
 }
@@ -0,0 +1,102 @@
+/* oem/src/HAL/button.c */
+#include "button.h"
+#include "adc.h"
+#include "input.h"
+#include "timing.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+// Debounced state and bookkeeping (shared between the EXTI ISR and Button_Reconcile)
+static volatile uint8_t  button_held = 0;
+static volatile uint32_t last_edge = 0;
+static uint32_t          lockout_cycles = 0;
+static volatile uint8_t  armed = 0;     // Set by Button_Init: edges before it are ignored
+static volatile ButtonStats_t stats = {0};
+
+//
+// Latches the current pin level, then lets edges in (the pin mode comes from
+// MX_GPIO_Init). The EXTI interrupt is enabled here, not at boot: until the
+// lockout is set up and the level latched, boot-time bounce would reach the
+// event ring unfiltered and start a game from the menu. If a regenerated
+// MX_GPIO_Init enables it early again, 'armed' still keeps those edges out.
+//
+void Button_Init(void)
+{
+    lockout_cycles = Timing_UsToCycles(BUTTON_LOCKOUT_US);
+    last_edge = Timing_Now() - lockout_cycles;
+    button_held = ADC_ReadButton();
+
+    // Edges latched since the pin was configured are stale
+    __HAL_GPIO_EXTI_CLEAR_IT(JOY_PIN_BUTTON);
+    HAL_NVIC_ClearPendingIRQ(EXTI15_10_IRQn);
+    armed = 1;
+
+    // Priority 5: at configMAX_SYSCALL_INTERRUPT_PRIORITY like the other ISRs
+    HAL_NVIC_SetPriority(EXTI15_10_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+}
+
+uint8_t Button_IsHeld(void)
+{
+    return button_held;
+}
+
+//
+// Accepts an edge: updates state and forwards it to the input event ring
+// Caller must be the EXTI ISR or hold a critical section that masks it.
+//
+static void Button_Accept(uint8_t pressed, uint32_t now)
+{
+    button_held = pressed;
+    last_edge = now;
+    stats.accepted_edges++;
+    stats.last_edge_cycles = now;
+
+    Input_PushEvent(pressed ? EVENT_FIRE_PRESS : EVENT_FIRE_RELEASE, now);
+}
+
+//
+// EXTI Callback (ISR context, priority 5)
+//
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    if (GPIO_Pin != JOY_PIN_BUTTON || !armed) return;
+
+    uint32_t now = Timing_Now();
+    uint8_t pressed = ADC_ReadButton();
+
+    // Inside the lockout, or the level already matches: contact bounce
+    if ((now - last_edge) < lockout_cycles || pressed == button_held) {
+        stats.rejected_bounces++;
+        return;
+    }
+
+    Button_Accept(pressed, now);
+}
+
+//
+// A bounce that settles inside the lockout leaves the pin at a level the
+// ISR never accepted (e.g. a quick release). Called from InputTask every
+// block; the critical section masks EXTI so the event ring keeps one producer.
+//
+void Button_Reconcile(void)
+{
+    taskENTER_CRITICAL();
+
+    uint32_t now = Timing_Now();
+    uint8_t pressed = ADC_ReadButton();
+
+    if (pressed != button_held && (now - last_edge) >= lockout_cycles) {
+        stats.resynced_edges++;
+        Button_Accept(pressed, now);
+    }
+
+    taskEXIT_CRITICAL();
+}
+
+void Button_GetStats(ButtonStats_t *out)
+{
+    taskENTER_CRITICAL();
+    *out = *(ButtonStats_t*)&stats;
+    taskEXIT_CRITICAL();
+}
@@ -90,6 +90,17 @@ void ClearScreen(void)
 	memset(framebuffer, 0, sizeof(framebuffer));
 }
 
+//
+// Inverts every pixel of the local framebuffer (whole-frame flash)
+//
+void InvertScreen(void)
+{
+	for (unsigned i = 0; i < sizeof(framebuffer); i++)
+	{
+		framebuffer[i] = ~framebuffer[i];
+	}
+}
+
 //
 // Sets or clears a specific pixel with bounds checking against screen dimensions
 //
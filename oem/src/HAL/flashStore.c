@@ -0,0 +1,420 @@
+/* oem/src/HAL/flashStore.c */
+#include "flashStore.h"
+#include "crc32.h"
+#include "main.h"
+#include "cmsis_os2.h"
+#include <stddef.h>
+#include <string.h>
+
+#define SECTOR_HEADER_SIZE  8u              // Magic, generation
+#define WORD_ERASED         0xFFFFFFFFu
+#define PAD4(n)             (((uint32_t)(n) + 3u) & ~3u)
+#define RECORD_WORDS_MAX    ((sizeof(FlashRecordHeader_t) + FLASH_STORE_MAX_PAYLOAD) / 4)
+#define RESERVE_BYTES       (FLASH_STORE_RESERVE_RECORDS * RECORD_WORDS_MAX * 4u)
+
+#if (FLASH_STORE_MAX_PAYLOAD % 4) != 0
+#error "Record payloads are programmed a word at a time"
+#endif
+
+// Newest record per key (addr 0 = never written)
+typedef struct {
+    uint32_t addr;
+    uint32_t seq;
+    uint16_t len;
+} IndexEntry_t;
+
+static IndexEntry_t store_index[FS_KEY_COUNT];
+
+// Pending writes, waiting for the persistence task
+static uint8_t  pending_data[FS_KEY_COUNT][FLASH_STORE_MAX_PAYLOAD];
+static uint16_t pending_len[FS_KEY_COUNT];
+static uint32_t pending_mask = 0;
+static volatile uint8_t reserve_requested = 0;
+
+// Log position (persistence task only after boot)
+static uint32_t active_base = 0;    // 0 = store unusable (format failed)
+static uint32_t write_addr = 0;
+static uint32_t next_seq = 1;
+
+static osMutexId_t  store_mutex = NULL;
+static osThreadId_t store_thread = NULL;
+static FlashStoreStats_t store_stats;
+
+//
+// Boot-time calls run before the scheduler, single threaded: no lock needed
+//
+static void Lock(void)
+{
+    if (osKernelGetState() == osKernelRunning) osMutexAcquire(store_mutex, osWaitForever);
+}
+
+static void Unlock(void)
+{
+    if (osKernelGetState() == osKernelRunning) osMutexRelease(store_mutex);
+}
+
+// Flash is memory mapped on the board; the host build backs it with an array
+static const void *FlashPtr(uint32_t addr)
+{
+#ifdef HOST_BUILD
+    return Host_FlashPtr(addr);
+#else
+    return (const void *)addr;
+#endif
+}
+
+static uint32_t ReadWord(uint32_t addr)
+{
+    return *(__IO const uint32_t *)FlashPtr(addr);
+}
+
+static uint32_t OtherSector(uint32_t base)
+{
+    return (base == FLASH_STORE_SECTOR_A) ? FLASH_STORE_SECTOR_B : FLASH_STORE_SECTOR_A;
+}
+
+static uint32_t RecordCrc(const FlashRecordHeader_t *hdr, const void *payload)
+{
+    uint32_t crc = Crc32_Update(0xFFFFFFFFu, hdr, offsetof(FlashRecordHeader_t, crc));
+    crc = Crc32_Update(crc, payload, hdr->len);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+static uint32_t RecordSize(uint16_t len)
+{
+    return sizeof(FlashRecordHeader_t) + PAD4(len);
+}
+
+static int EraseSector(uint32_t base)
+{
+    FLASH_EraseInitTypeDef erase;
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    erase.Sector = (base == FLASH_STORE_SECTOR_A) ? FLASH_SECTOR_6 : FLASH_SECTOR_7;
+    erase.NbSectors = 1;
+
+    uint32_t sector_error = 0;
+    HAL_FLASH_Unlock();
+    HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&erase, &sector_error);
+    HAL_FLASH_Lock();
+
+    return status == HAL_OK;
+}
+
+static int ProgramWords(uint32_t addr, const uint32_t *words, uint32_t count)
+{
+    int ok = 1;
+
+    HAL_FLASH_Unlock();
+    for (uint32_t i = 0; i < count && ok; i++) {
+        ok = (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, addr + 4 * i, words[i]) == HAL_OK);
+    }
+    HAL_FLASH_Lock();
+
+    return ok;
+}
+
+//
+// Walks one sector's log into the index. A record that fails its CRC (power
+// cut mid-write) is skipped by its length; a length that can't be trusted
+// ends the log, so the rest of the sector is never appended to.
+//
+static void ScanSector(uint32_t base)
+{
+    uint32_t addr = base + SECTOR_HEADER_SIZE;
+    uint32_t end = base + FLASH_STORE_SECTOR_SIZE;
+
+    while (addr + sizeof(FlashRecordHeader_t) <= end && ReadWord(addr) != WORD_ERASED)
+    {
+        const FlashRecordHeader_t *hdr = FlashPtr(addr);
+
+        if (hdr->len > FLASH_STORE_MAX_PAYLOAD || addr + RecordSize(hdr->len) > end) {
+            store_stats.records_corrupt++;
+            addr = end;
+            break;
+        }
+
+        if (hdr->key < FS_KEY_COUNT && RecordCrc(hdr, hdr + 1) == hdr->crc) {
+            IndexEntry_t *entry = &store_index[hdr->key];
+            if (entry->addr == 0 || hdr->seq > entry->seq) {
+                entry->addr = addr;
+                entry->seq = hdr->seq;
+                entry->len = hdr->len;
+            }
+            if (hdr->seq >= next_seq) next_seq = hdr->seq + 1;
+        }
+        else {
+            store_stats.records_corrupt++;
+        }
+
+        addr += RecordSize(hdr->len);
+    }
+
+    write_addr = addr;
+}
+
+//
+// Copies the newest record of every key into the other sector. Its magic is
+// programmed last, so until the copy is complete the old sector stays active.
+//
+static int Compact(void)
+{
+    uint32_t target = OtherSector(active_base);
+    uint32_t generation = store_stats.generation + 1;
+    uint32_t magic = FLASH_STORE_MAGIC;
+    IndexEntry_t moved[FS_KEY_COUNT];
+
+    if (!EraseSector(target)) return 0;
+    if (!ProgramWords(target + 4, &generation, 1)) return 0;
+
+    uint32_t addr = target + SECTOR_HEADER_SIZE;
+    for (int key = 0; key < FS_KEY_COUNT; key++)
+    {
+        moved[key] = store_index[key];
+        if (store_index[key].addr == 0) continue;
+
+        // Verbatim copy: header, CRC and sequence stay valid
+        uint32_t size = RecordSize(store_index[key].len);
+        if (!ProgramWords(addr, FlashPtr(store_index[key].addr), size / 4)) return 0;
+
+        moved[key].addr = addr;
+        addr += size;
+    }
+
+    if (!ProgramWords(target, &magic, 1)) return 0;
+
+    Lock();
+    memcpy(store_index, moved, sizeof(store_index));
+    Unlock();
+
+    active_base = target;
+    write_addr = addr;
+    store_stats.generation = generation;
+    store_stats.compactions++;
+    return 1;
+}
+
+static FlashStoreStatus_t AppendRecord(FlashStoreKey_t key, const void *data, uint16_t len)
+{
+    static uint32_t image[RECORD_WORDS_MAX];    // Persistence task only: kept off its stack
+    FlashRecordHeader_t *hdr = (FlashRecordHeader_t *)image;
+    uint32_t size = RecordSize(len);
+
+    if (write_addr + size > active_base + FLASH_STORE_SECTOR_SIZE && !Compact()) {
+        return FS_ERR_FLASH;
+    }
+
+    memset(image, 0, sizeof(image));
+    hdr->key = (uint16_t)key;
+    hdr->len = len;
+    hdr->seq = next_seq;
+    memcpy(hdr + 1, data, len);
+    hdr->crc = RecordCrc(hdr, hdr + 1);
+
+    uint32_t addr = write_addr;
+    int ok = ProgramWords(addr, image, size / 4);
+
+    // A half-programmed record still occupies its space; the boot scan skips it by CRC
+    write_addr += size;
+    next_seq++;
+    if (!ok) return FS_ERR_FLASH;
+
+    Lock();
+    store_index[key].addr = addr;
+    store_index[key].seq = hdr->seq;
+    store_index[key].len = len;
+    Unlock();
+
+    store_stats.records_written++;
+    return FS_OK;
+}
+
+//
+// First use: claim sector 6. Firmware before the log kept the high score as a
+// raw word at the start of sector 7, so carry that over as the first record.
+//
+static void Format(void)
+{
+    uint32_t legacy_score = ReadWord(FLASH_STORE_SECTOR_B);
+    uint32_t generation = 1;
+    uint32_t magic = FLASH_STORE_MAGIC;
+
+    if (!EraseSector(FLASH_STORE_SECTOR_A) ||
+        !ProgramWords(FLASH_STORE_SECTOR_A + 4, &generation, 1) ||
+        !ProgramWords(FLASH_STORE_SECTOR_A, &magic, 1))
+    {
+        store_stats.write_errors++;
+        return;
+    }
+
+    active_base = FLASH_STORE_SECTOR_A;
+    write_addr = FLASH_STORE_SECTOR_A + SECTOR_HEADER_SIZE;
+    store_stats.generation = generation;
+
+    if (legacy_score != WORD_ERASED) {
+        AppendRecord(FS_KEY_HIGH_SCORE, &legacy_score, sizeof(legacy_score));
+    }
+}
+
+//
+// Everything RAM-side starts from scratch, so a second call behaves like a
+// reboot (the host checks rely on that to re-scan after a power cut)
+//
+void FlashStore_Init(void)
+{
+    if (!store_mutex) store_mutex = osMutexNew(NULL);
+    if (!store_mutex) Error_Handler();
+
+    memset(store_index, 0, sizeof(store_index));
+    memset(&store_stats, 0, sizeof(store_stats));
+    pending_mask = 0;
+    reserve_requested = 0;
+    active_base = 0;
+    write_addr = 0;
+    next_seq = 1;
+
+    int a_valid = (ReadWord(FLASH_STORE_SECTOR_A) == FLASH_STORE_MAGIC);
+    int b_valid = (ReadWord(FLASH_STORE_SECTOR_B) == FLASH_STORE_MAGIC);
+
+    if (a_valid && b_valid) {
+        // Interrupted before the stale sector was reused: the newer generation wins
+        uint32_t gen_a = ReadWord(FLASH_STORE_SECTOR_A + 4);
+        uint32_t gen_b = ReadWord(FLASH_STORE_SECTOR_B + 4);
+        active_base = ((int32_t)(gen_b - gen_a) > 0) ? FLASH_STORE_SECTOR_B : FLASH_STORE_SECTOR_A;
+    }
+    else if (a_valid) {
+        active_base = FLASH_STORE_SECTOR_A;
+    }
+    else if (b_valid) {
+        active_base = FLASH_STORE_SECTOR_B;
+    }
+    else {
+        Format();
+        return;
+    }
+
+    store_stats.generation = ReadWord(active_base + 4);
+    ScanSector(active_base);
+}
+
+FlashStoreStatus_t FlashStore_Read(FlashStoreKey_t key, void *data, uint16_t *len)
+{
+    if (key >= FS_KEY_COUNT) return FS_ERR_BAD_KEY;
+
+    FlashStoreStatus_t status = FS_OK;
+    const void *src = NULL;
+    uint16_t size = 0;
+
+    Lock();
+    if (pending_mask & (1u << key)) {
+        // Not committed yet, but it is the value the caller last wrote
+        src = pending_data[key];
+        size = pending_len[key];
+    }
+    else if (store_index[key].addr) {
+        src = FlashPtr(store_index[key].addr + sizeof(FlashRecordHeader_t));
+        size = store_index[key].len;
+    }
+
+    if (src) {
+        if (size > *len) size = *len;
+        memcpy(data, src, size);
+        *len = size;
+    }
+    else {
+        status = FS_ERR_NOT_FOUND;
+    }
+    Unlock();
+
+    return status;
+}
+
+FlashStoreStatus_t FlashStore_Write(FlashStoreKey_t key, const void *data, uint16_t len)
+{
+    if (key >= FS_KEY_COUNT) return FS_ERR_BAD_KEY;
+    if (len > FLASH_STORE_MAX_PAYLOAD) return FS_ERR_TOO_LARGE;
+
+    Lock();
+    memcpy(pending_data[key], data, len);
+    pending_len[key] = len;
+    pending_mask |= (1u << key);
+    Unlock();
+
+    return FS_OK;
+}
+
+void FlashStore_Commit(void)
+{
+    if (store_thread) osThreadFlagsSet(store_thread, FLASH_STORE_FLAG_COMMIT);
+}
+
+void FlashStore_CommitReserve(void)
+{
+    reserve_requested = 1;
+    FlashStore_Commit();
+}
+
+//
+// Read without the lock: write_addr only moves forward between compactions,
+// so a stale view errs towards "doesn't fit" and the caller simply waits
+//
+int FlashStore_Fits(uint16_t len)
+{
+    if (len > FLASH_STORE_MAX_PAYLOAD) return 0;
+    return active_base && write_addr + RecordSize(len) <= active_base + FLASH_STORE_SECTOR_SIZE;
+}
+
+void FlashStore_AttachTask(void)
+{
+    store_thread = osThreadGetId();
+}
+
+void FlashStore_Flush(void)
+{
+    static uint8_t data[FLASH_STORE_MAX_PAYLOAD];
+    uint16_t len;
+
+    for (int key = 0; key < FS_KEY_COUNT; key++)
+    {
+        Lock();
+        if (!(pending_mask & (1u << key))) {
+            Unlock();
+            continue;
+        }
+        len = pending_len[key];
+        memcpy(data, pending_data[key], len);
+        pending_mask &= ~(1u << key);
+        Unlock();
+
+        // Rewriting the value already on flash only costs wear
+        const IndexEntry_t *entry = &store_index[key];
+        if (entry->addr && entry->len == len &&
+            memcmp(FlashPtr(entry->addr + sizeof(FlashRecordHeader_t)), data, len) == 0) {
+            continue;
+        }
+
+        if (active_base == 0 || AppendRecord((FlashStoreKey_t)key, data, len) != FS_OK) {
+            store_stats.write_errors++;
+        }
+    }
+
+    // Erase now, on the end screen, rather than under the next run's idle mirrors
+    if (reserve_requested) {
+        reserve_requested = 0;
+        if (active_base && active_base + FLASH_STORE_SECTOR_SIZE - write_addr < RESERVE_BYTES) {
+            if (Compact()) {
+                store_stats.early_compactions++;
+            }
+            else {
+                store_stats.write_errors++;
+            }
+        }
+    }
+}
+
+void FlashStore_GetStats(FlashStoreStats_t *stats)
+{
+    *stats = store_stats;
+    stats->active_sector = active_base;
+    stats->bytes_free = active_base ? (active_base + FLASH_STORE_SECTOR_SIZE - write_addr) : 0;
+}
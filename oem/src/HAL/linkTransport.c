@@ -0,0 +1,208 @@
+/* oem/src/HAL/linkTransport.c */
+#include "linkTransport.h"
+#include <string.h>
+
+#ifdef HOST_BUILD
+#include <fcntl.h>
+#include <unistd.h>
+#define __DMB() __sync_synchronize()
+#else
+#include "main.h"
+#endif
+
+// ==================== Byte Rings ====================
+
+// Single producer / single consumer, same scheme as the input event queue
+static int Ring_Write(uint8_t *ring, volatile uint16_t *head, volatile uint16_t *tail, uint16_t size,
+                      const uint8_t *data, uint16_t len)
+{
+    uint16_t h = *head;
+    if ((uint16_t)(size - (uint16_t)(h - *tail)) < len) return 0;
+
+    for (uint16_t i = 0; i < len; i++) ring[(uint16_t)(h + i) & (size - 1)] = data[i];
+    __DMB();
+    *head = h + len;
+    return 1;
+}
+
+static uint16_t Ring_Read(const uint8_t *ring, volatile uint16_t *head, volatile uint16_t *tail, uint16_t size,
+                          uint8_t *data, uint16_t max)
+{
+    uint16_t t = *tail;
+    uint16_t n = (uint16_t)(*head - t);
+    if (n > max) n = max;
+
+    __DMB();
+    for (uint16_t i = 0; i < n; i++) data[i] = ring[(uint16_t)(t + i) & (size - 1)];
+    __DMB();
+    *tail = t + n;
+    return n;
+}
+
+// ==================== Loopback ====================
+
+// ring[n] carries what end n sends
+static int Loop_Send0(void *ctx, const uint8_t *data, uint16_t len)
+{
+    LinkLoopback_t *l = ctx;
+    return Ring_Write(l->ring[0], &l->head[0], &l->tail[0], LINK_LOOPBACK_RING, data, len);
+}
+
+static int Loop_Send1(void *ctx, const uint8_t *data, uint16_t len)
+{
+    LinkLoopback_t *l = ctx;
+    return Ring_Write(l->ring[1], &l->head[1], &l->tail[1], LINK_LOOPBACK_RING, data, len);
+}
+
+static uint16_t Loop_Recv0(void *ctx, uint8_t *data, uint16_t max)
+{
+    LinkLoopback_t *l = ctx;
+    return Ring_Read(l->ring[1], &l->head[1], &l->tail[1], LINK_LOOPBACK_RING, data, max);
+}
+
+static uint16_t Loop_Recv1(void *ctx, uint8_t *data, uint16_t max)
+{
+    LinkLoopback_t *l = ctx;
+    return Ring_Read(l->ring[0], &l->head[0], &l->tail[0], LINK_LOOPBACK_RING, data, max);
+}
+
+void LinkLoopback_Init(LinkLoopback_t *loop)
+{
+    memset(loop, 0, sizeof(*loop));
+    loop->end[0] = (LinkTransport_t){ Loop_Send0, Loop_Recv0, loop };
+    loop->end[1] = (LinkTransport_t){ Loop_Send1, Loop_Recv1, loop };
+}
+
+#ifdef HOST_BUILD
+// ==================== Host: File Descriptor ====================
+
+// All or nothing like the UART ring: a short write would split a frame
+static int Fd_Send(void *ctx, const uint8_t *data, uint16_t len)
+{
+    ssize_t n = write(*(int *)ctx, data, len);
+    if (n == len) return 1;
+    return 0;
+}
+
+static uint16_t Fd_Recv(void *ctx, uint8_t *data, uint16_t max)
+{
+    if (max == 0) return 0;
+
+    ssize_t n = read(*(int *)ctx, data, max);
+    return n > 0 ? (uint16_t)n : 0;
+}
+
+void LinkFd_Init(LinkTransport_t *t, int *fd)
+{
+    fcntl(*fd, F_SETFL, fcntl(*fd, F_GETFL) | O_NONBLOCK);
+    t->send = Fd_Send;
+    t->recv = Fd_Recv;
+    t->ctx = fd;
+}
+#else
+// ==================== Device: USART6 ====================
+
+// Peripheral owned by this driver (same pattern as ADC_Trigger_Init owning TIM3)
+static UART_HandleTypeDef huart6;
+
+// TX: logic task -> TXE interrupt. RX: RXNE interrupt -> logic task.
+static uint8_t tx_ring[LINK_UART_RING];
+static uint8_t rx_ring[LINK_UART_RING];
+static volatile uint16_t tx_head = 0, tx_tail = 0;
+static volatile uint16_t rx_head = 0, rx_tail = 0;
+static volatile uint32_t rx_overruns = 0;
+
+static int Uart_Send(void *ctx, const uint8_t *data, uint16_t len)
+{
+    if (!Ring_Write(tx_ring, &tx_head, &tx_tail, LINK_UART_RING, data, len)) return 0;
+
+    // The ISR clears TXEIE once the ring drains; setting it again restarts it
+    SET_BIT(huart6.Instance->CR1, USART_CR1_TXEIE);
+    return 1;
+}
+
+static uint16_t Uart_Recv(void *ctx, uint8_t *data, uint16_t max)
+{
+    return Ring_Read(rx_ring, &rx_head, &rx_tail, LINK_UART_RING, data, max);
+}
+
+static const LinkTransport_t uart_transport = { Uart_Send, Uart_Recv, NULL };
+
+//
+// USART6 on PC6 (TX) / PC7 (RX), 8N1, interrupt driven in both directions
+//
+const LinkTransport_t *LinkUart_Init(void)
+{
+    if (huart6.Instance) return &uart_transport;
+
+    __HAL_RCC_GPIOC_CLK_ENABLE();
+    __HAL_RCC_USART6_CLK_ENABLE();
+
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+    GPIO_InitStruct.Pin = GPIO_PIN_6 | GPIO_PIN_7;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;     // Idle high with the cable unplugged
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    GPIO_InitStruct.Alternate = GPIO_AF8_USART6;
+    HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+
+    huart6.Instance = USART6;
+    huart6.Init.BaudRate = LINK_UART_BAUD;
+    huart6.Init.WordLength = UART_WORDLENGTH_8B;
+    huart6.Init.StopBits = UART_STOPBITS_1;
+    huart6.Init.Parity = UART_PARITY_NONE;
+    huart6.Init.Mode = UART_MODE_TX_RX;
+    huart6.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+    huart6.Init.OverSampling = UART_OVERSAMPLING_16;
+    if (HAL_UART_Init(&huart6) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    // Priority 5: at configMAX_SYSCALL_INTERRUPT_PRIORITY like the other ISRs
+    HAL_NVIC_SetPriority(USART6_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(USART6_IRQn);
+    __HAL_UART_ENABLE_IT(&huart6, UART_IT_RXNE);
+
+    return &uart_transport;
+}
+
+uint32_t LinkUart_GetOverruns(void)
+{
+    return rx_overruns;
+}
+
+//
+// One byte per interrupt each way; at LINK_UART_BAUD that is ~23k/s at most
+//
+void USART6_IRQHandler(void)
+{
+    USART_TypeDef *uart = huart6.Instance;
+    uint32_t sr = uart->SR;
+
+    // Reading DR clears RXNE and, after the SR read above, ORE
+    if (sr & (USART_SR_RXNE | USART_SR_ORE)) {
+        uint8_t byte = (uint8_t)uart->DR;
+        if (sr & USART_SR_ORE) rx_overruns++;
+        if (sr & USART_SR_RXNE) {
+            if ((uint16_t)(rx_head - rx_tail) < LINK_UART_RING) {
+                rx_ring[rx_head & (LINK_UART_RING - 1)] = byte;
+                rx_head++;
+            }
+            else {
+                rx_overruns++;
+            }
+        }
+    }
+
+    if ((sr & USART_SR_TXE) && (uart->CR1 & USART_CR1_TXEIE)) {
+        if (tx_head != tx_tail) {
+            uart->DR = tx_ring[tx_tail & (LINK_UART_RING - 1)];
+            tx_tail++;
+        }
+        else {
+            CLEAR_BIT(uart->CR1, USART_CR1_TXEIE);
+        }
+    }
+}
+#endif
@@ -7,17 +7,18 @@
 #include "gameLogic.h"
 #include <stdio.h>
 
-void UI_DrawMenu(MenuOption_t selected)
+void UI_DrawMenu(MenuOption_t selected, uint8_t linking)
 {
+    static const char *const labels[] = { "CLASSIC", "ARCADE", "CO-OP LINK" };
+
     DrawBigTitle(15, 5); // Draws game title
 
     // --- Menu Options ---
-    if (selected == MENU_CLASSIC) {
-        DrawString(30, 30, "> CLASSIC");
-        DrawString(30, 42, "  ARCADE");
-    } else {
-        DrawString(30, 30, "  CLASSIC");
-        DrawString(30, 42, "> ARCADE");
+    for (int i = 0; i < 3; i++) {
+        char line[16];
+        const char *label = (i == MENU_LINK && linking) ? "LINKING..." : labels[i];
+        snprintf(line, sizeof(line), "%c %s", (i == selected) ? '>' : ' ', label);
+        DrawString(30, 27 + i * 10, line);
     }
 
     // --- High Score Display ---
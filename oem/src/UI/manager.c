@@ -1,29 +1,81 @@
 /* oem/src/UI/manager.c */
 #include "gameLogic.h"
+#include "appConfig.h"
 #include "input.h"
 #include "raycaster.h"
 #include "levels.h"
-#include "display.h"
+#include "timing.h"
+#include "flowfield.h"
+#include "collision.h"
+#include "spatial.h"
+#include "aiScheduler.h"
+#include "pvs.h"
+#include "spawn.h"
+#include "rng.h"
+#include "projectile.h"
+#include "particles.h"
+#include "effects.h"
 #include <math.h>
-#include <stdlib.h> // For rand()
+#include <string.h>
 
 GameState_t Game;
+GameSession_t Session;
 
 static int IsValidLevel(int idx) {
     return (idx >= 0 && idx < TOTAL_LEVELS);
 }
 
-void Game_Init(GameMode_t mode)
+static void InitRun(GameMode_t mode, uint32_t seed, uint8_t linked)
 {
     Game.state = STATE_MENU;
     Game.mode = mode;
+    Game.linked = linked;
 
     Game.high_score = LoadHighScore();
     Game.current_score = 0;
 
+    // Deterministic start: same seed + same inputs = same trajectory
+    Game.rng_seed = seed;
+    Game.rng_state = Rng_Seed(seed);
+    Game.tick = 0;
+    Game.ai_cursor = 0;
+    Session.input_timestamp = 0;
+
     Game_LoadLevel(0);
 }
 
+void Game_Init(GameMode_t mode, uint32_t seed)
+{
+    Session.local_player = 0;
+    InitRun(mode, seed, 0);
+}
+
+//
+// Both boards of a link call this with the same mode and seed; only the
+// viewpoint differs. 'local_player' 0 plays Game.player, 1 Game.partner.
+//
+void Game_InitLinked(GameMode_t mode, uint32_t seed, uint8_t local_player)
+{
+    Session.local_player = local_player;
+    InitRun(mode, seed, 1);
+}
+
+//
+// Level-derived tables only (walls, visibility, spawn cells, flow field);
+// the player and enemies are left alone. 'level_index' must be valid.
+//
+void Game_PrepareLevel(int level_index)
+{
+    Game.current_level_idx = level_index;
+    const Level_t *level = Game_Level();
+
+    // Old field/occupancy describe the previous level's walls
+    Collision_LoadLevel(level);
+    Pvs_LoadLevel(level_index, level);
+    Spawn_LoadLevel(level);
+    FlowField_Reset(&Game.flow);
+}
+
 void Game_LoadLevel(int level_index)
 {
     if (!IsValidLevel(level_index)) {
@@ -31,13 +83,13 @@ void Game_LoadLevel(int level_index)
         return;
     }
 
-    Game.current_level_idx = level_index;
-    Game.current_level = AllLevels[level_index];
+    Game_PrepareLevel(level_index);
+    const Level_t *level = Game_Level();
 
     // Reset Player
-    Game.player.x = Game.current_level->start_x;
-    Game.player.y = Game.current_level->start_y;
-    float angle = Game.current_level->start_angle;
+    Game.player.x = level->start_x;
+    Game.player.y = level->start_y;
+    float angle = level->start_angle;
 
     Game.player.dir_x = cosf(angle);
     Game.player.dir_y = sinf(angle);
@@ -46,122 +98,368 @@ void Game_LoadLevel(int level_index)
 
     Game.player.health = 100;
 
+    // The partner starts half a cell behind, facing the same way. Alone it stays
+    // down (health 0), which every player loop below skips.
+    memset(&Game.partner, 0, sizeof(Game.partner));
+    if (Game.linked) {
+        Game.partner = Game.player;
+        Collision_MoveCircle(&Game.partner.x, &Game.partner.y,
+                             -Game.player.dir_x * 0.5f, -Game.player.dir_y * 0.5f, PLAYER_RADIUS);
+    }
+
     // Reset Enemies
-    for(int i=0; i<5; i++) Game.enemies[i].active = 0;
+    Entity_Clear(&Game.entities);
+    Spatial_Clear(&Game.grid);
+    Projectile_Clear(&Game.projectiles);
 
-    for(int i=0; i < Game.current_level->enemy_count; i++) {
-        Game.enemies[i].x = Game.current_level->enemies[i].x;
-        Game.enemies[i].y = Game.current_level->enemies[i].y;
-        Game.enemies[i].active = 1;
-        Game.enemies[i].health = 3;
+    for(int i=0; i < level->enemy_count; i++) {
+        Game_SpawnEnemy(level->enemies[i].x, level->enemies[i].y);
     }
 }
 
-void Game_Update(void)
+//
+// Spawn/kill go through here so the spatial index always mirrors the entity store
+//
+int Game_SpawnEnemy(float x, float y)
 {
-    if (Game.state != STATE_PLAYING) return;
-    PlayerInput_t input = Input_ReadState();
+    int idx = Entity_Spawn(&Game.entities, ENTITY_TYPE_ENEMY, x, y, ENEMY_HEALTH);
+    if (idx != ENTITY_NONE) {
+        Game.entities.think_tick[idx] = Game.tick;
+        Game.entities.fire_tick[idx] = Game.tick + ENEMY_FIRE_COOLDOWN_S * LOGIC_HZ;
+        Spatial_Insert(&Game.grid, idx, x, y);
+    }
+    return idx;
+}
+
+void Game_KillEnemy(int idx)
+{
+    Spatial_Remove(&Game.grid, idx);
+    Entity_Kill(&Game.entities, idx);
+}
+
+//
+// Players still up, always player before partner so every linked board
+// visits them in the same order. A single-player run only has the first.
+//
+static int LivePlayers(Player_t **live)
+{
+    int n = 0;
+    if (Game.player.health > 0) live[n++] = &Game.player;
+    if (Game.partner.health > 0) live[n++] = &Game.partner;
+    return n;
+}
+
+// Feedback (muzzle flash, hit marker, damage flash) only for this board's player
+static int IsLocal(const Player_t *p)
+{
+    return p == Game_LocalPlayer();
+}
+
+static void MovePlayer(Player_t *p, const InputSnapshot_t *input)
+{
+    if (p->health <= 0) return;
 
     // Rotation
-    if (fabsf(input.x) > 0.15f) {
-        float rotSpeed = input.x * 0.05f;
+    if (fabsf(input->x) > STICK_DEADZONE) {
+        float rotSpeed = input->x * PLAYER_ROT_SPEED * LOGIC_DT;
         float s = sinf(-rotSpeed);
         float c = cosf(-rotSpeed);
-        float oldDirX = Game.player.dir_x;
-        Game.player.dir_x = Game.player.dir_x * c - Game.player.dir_y * s;
-        Game.player.dir_y = oldDirX * s + Game.player.dir_y * c;
-        float oldPlaneX = Game.player.plane_x;
-        Game.player.plane_x = Game.player.plane_x * c - Game.player.plane_y * s;
-        Game.player.plane_y = oldPlaneX * s + Game.player.plane_y * c;
+        float oldDirX = p->dir_x;
+        p->dir_x = p->dir_x * c - p->dir_y * s;
+        p->dir_y = oldDirX * s + p->dir_y * c;
+        float oldPlaneX = p->plane_x;
+        p->plane_x = p->plane_x * c - p->plane_y * s;
+        p->plane_y = oldPlaneX * s + p->plane_y * c;
     }
 
     // Movement
-    if (fabsf(input.y) > 0.15f) {
-        float moveSpeed = input.y * 0.08f;
-        float nextX = Game.player.x + Game.player.dir_x * moveSpeed;
-        float nextY = Game.player.y + Game.player.dir_y * moveSpeed;
-
-        if(Game.current_level->map[(int)nextX][(int)Game.player.y] == 0) Game.player.x = nextX;
-        if(Game.current_level->map[(int)Game.player.x][(int)nextY] == 0) Game.player.y = nextY;
+    if (fabsf(input->y) > STICK_DEADZONE) {
+        float moveSpeed = input->y * PLAYER_MOVE_SPEED * LOGIC_DT;
+        Collision_MoveCircle(&p->x, &p->y, p->dir_x * moveSpeed, p->dir_y * moveSpeed, PLAYER_RADIUS);
     }
 }
 
+void Game_Update(const InputSnapshot_t *input)
+{
+    if (Game.state != STATE_PLAYING) return;
+
+    // The pose computed below reflects this sample; the renderer carries it to the OLED
+    Session.input_timestamp = input->timestamp;
+    MovePlayer(&Game.player, input);
+}
+
+//
+// Copies this board's authoritative player pose into a render camera
+//
+void Game_GetCamera(Camera_t *cam)
+{
+    const Player_t *p = Game_LocalPlayer();
+
+    cam->x = p->x;
+    cam->y = p->y;
+    cam->dir_x = p->dir_x;
+    cam->dir_y = p->dir_y;
+    cam->plane_x = p->plane_x;
+    cam->plane_y = p->plane_y;
+}
+
+//
+// Late Latch: applies the yaw the stick has commanded since the sample the
+// last logic tick consumed. Only the caller's camera copy is touched.
+// Returns 1 if a provisional rotation was applied.
+//
+int Game_LateLatchCamera(Camera_t *cam, const InputSample_t *latest)
+{
+    if (Game.state != STATE_PLAYING || Session.input_timestamp == 0) return 0;
+    if (fabsf(latest->x) <= STICK_DEADZONE) return 0;
+
+    if ((int32_t)(latest->timestamp - Session.input_timestamp) <= 0) return 0;
+
+    uint32_t ahead_us = Timing_CyclesToUs(latest->timestamp - Session.input_timestamp);
+    if (ahead_us > LATE_LATCH_MAX_MS * 1000u) ahead_us = LATE_LATCH_MAX_MS * 1000u;
+
+    // Same rate the logic tick would apply, over the time the sample is ahead
+    float seconds = (float)ahead_us * 1e-6f;
+    Camera_Rotate(cam, -latest->x * PLAYER_ROT_SPEED * seconds);
+    return 1;
+}
+
 static int IsFacingEnemy(float playerAngle, float angleToEnemy, float threshold) {
     float diff = fabsf(playerAngle - angleToEnemy);
     if (diff > 3.14159f) diff = 6.28318f - diff;
     return (diff < threshold);
 }
 
-void Game_HandleCombat(void)
+static void PlayerShoot(const Player_t *p, const InputSnapshot_t *input)
 {
-    PlayerInput_t input = Input_ReadState();
+    if (p->health <= 0) return;
 
-    if (input.is_firing)
+    // Held fire keeps shooting; a tap that started and ended between ticks still fires once
+    if (input->fire_held || input->fire_presses)
     {
-        // Visual Recoil/Flash
-        DrawVLine(62, 28, 36, 1);
-        DrawVLine(66, 28, 36, 1);
+        int own = IsLocal(p);
 
+        // Visual Recoil/Flash (drawn by the render task)
+        if (own) Effects_Trigger(EFFECT_MUZZLE_FLASH);
+
+        EntityStore_t *ents = &Game.entities;
         float maxRangeSq = 64.0f;
+        float playerAngle = atan2f(p->dir_y, p->dir_x);
+        float invDet = 1.0f / (p->plane_x * p->dir_y - p->dir_x * p->plane_y);
+
+        // Gather every enemy inside the aim cone, then occlusion-test them in batches
+        uint8_t candidate[ENTITY_CAPACITY];
+        float   offsets[ENTITY_CAPACITY];
+        float   depth[ENTITY_CAPACITY];
+        int     n = 0;
 
-        for(int i=0; i<5; i++) {
-            if (!Game.enemies[i].active) continue;
+        int pcx = (int)p->x, pcy = (int)p->y;
 
-            float dx = Game.enemies[i].x - Game.player.x;
-            float dy = Game.enemies[i].y - Game.player.y;
+        ENTITY_FOREACH(ents, i) {
+            // Walls certainly between us: skip before any trig or ray work
+            if (!Pvs_CanSee(pcx, pcy, (int)ents->x[i], (int)ents->y[i])) continue;
+
+            float dx = ents->x[i] - p->x;
+            float dy = ents->y[i] - p->y;
             float distSq = (dx*dx + dy*dy);
 
             if (distSq < maxRangeSq)
             {
                 float angleToEnemy = atan2f(dy, dx);
-                float playerAngle = atan2f(Game.player.dir_y, Game.player.dir_x);
 
                 if (IsFacingEnemy(playerAngle, angleToEnemy, 0.35f))
                 {
-                    Game.enemies[i].health--;
-
-                    if (Game.enemies[i].health <= 0) {
-                        Game.enemies[i].active = 0;
-
-                        Game.current_score += 100;
-                        if (Game.current_score > Game.high_score) {
-                            Game.high_score = Game.current_score;
-                            SaveHighScore(Game.high_score);
-                        }
-                    }
-                    return;
+                    // Camera-space position: the ray dir + plane * offset passes through
+                    // the enemy at distance 'depth' (same transform as the sprite pass)
+                    float transformX = invDet * (p->dir_y * dx - p->dir_x * dy);
+                    float transformY = invDet * (-p->plane_y * dx + p->plane_x * dy);
+                    if (transformY <= 0.0f) continue;
+
+                    candidate[n] = (uint8_t)i;
+                    offsets[n] = transformX / transformY;
+                    depth[n] = transformY;
+                    n++;
                 }
             }
         }
+
+        if (n == 0) return;
+
+        RayBatch_t batch = {
+            .origin_x = p->x, .origin_y = p->y,
+            .dir_x = p->dir_x, .dir_y = p->dir_y,
+            .plane_x = p->plane_x, .plane_y = p->plane_y,
+            .max_steps = 0
+        };
+        RayHit_t hits[ENTITY_CAPACITY];
+        for (int k = 0; k < n; k += RAY_BATCH_MAX) {
+            int chunk = (n - k > RAY_BATCH_MAX) ? RAY_BATCH_MAX : (n - k);
+            Raycast_CastBatch(&batch, &offsets[k], &hits[k], chunk);
+        }
+
+        // Nearest enemy that is in front of the wall along its ray takes the shot
+        int target = -1;
+        for (int k = 0; k < n; k++) {
+            if (hits[k].tile != 0 && hits[k].distance < depth[k]) continue;
+            if (target < 0 || depth[k] < depth[target]) target = k;
+        }
+        if (target < 0) return;
+
+        int i = candidate[target];
+        ents->health[i]--;
+        if (own) Effects_Trigger(EFFECT_HIT_MARKER);
+
+        if (ents->health[i] <= 0) {
+            Effects_Burst(ents->x[i], ents->y[i], PARTICLE_DEATH_COUNT);
+            if (own) Effects_Trigger(EFFECT_SCREEN_SHAKE);
+            Game_KillEnemy(i);
+
+            // Shared by both players of a linked run.
+            // Persisted at game over (tasks.c): flash writes never run from the simulation
+            Game.current_score += 100;
+            if (Game.current_score > Game.high_score) {
+                Game.high_score = Game.current_score;
+            }
+        }
+        else {
+            Effects_Burst(ents->x[i], ents->y[i], PARTICLE_HIT_COUNT);
+        }
     }
 }
 
-void Game_UpdateAI(void)
+void Game_HandleCombat(const InputSnapshot_t *input)
 {
-    int active_enemies = 0;
+    PlayerShoot(&Game.player, input);
+}
 
-    // AI Logic
-    for(int i = 0; i < 5; i++)
-    {
-        if(!Game.enemies[i].active) continue;
-        active_enemies++;
+//
+// One enemy decision. 'age' is the number of ticks since its previous think,
+// so movement covers the same ground whatever rate the scheduler achieved.
+//
+void Game_ThinkEnemy(int i, uint32_t age)
+{
+    EntityStore_t *ents = &Game.entities;
+    float think_dt = age * LOGIC_DT;
+    uint8_t near[ENTITY_CAPACITY];
+
+    // Hunt the nearest player still up (ties go to the first)
+    Player_t *live[2];
+    int n_live = LivePlayers(live);
+    if (n_live == 0) {
+        ents->state[i] = ENTITY_STATE_IDLE;
+        return;
+    }
+
+    const Player_t *target = live[0];
+    float dx = target->x - ents->x[i];
+    float dy = target->y - ents->y[i];
+    float distSq = dx*dx + dy*dy;
+
+    if (n_live > 1) {
+        float bx = live[1]->x - ents->x[i];
+        float by = live[1]->y - ents->y[i];
+        if (bx*bx + by*by < distSq) {
+            target = live[1];
+            dx = bx;
+            dy = by;
+            distSq = bx*bx + by*by;
+        }
+    }
+
+    // Perception: an idle enemy only notices a player it could see; once chasing,
+    // it keeps tracking through the flow field even around corners
+    int aware = (ents->state[i] == ENTITY_STATE_CHASE) ||
+                Pvs_CanSee((int)ents->x[i], (int)ents->y[i], (int)target->x, (int)target->y);
 
-        float dx = Game.player.x - Game.enemies[i].x;
-        float dy = Game.player.y - Game.enemies[i].y;
-        float distSq = dx*dx + dy*dy;
+    if (aware && distSq > 0.25f && distSq < 100.0f) {
+        ents->state[i] = ENTITY_STATE_CHASE;
+
+        // Follow the flow field toward the centre of the next cell on the path;
+        // straight chase only once in the player's cell (or before a field exists)
+        int next_x, next_y;
+        if (FlowField_NextCell(&Game.flow, (int)ents->x[i], (int)ents->y[i], &next_x, &next_y)) {
+            dx = (next_x + 0.5f) - ents->x[i];
+            dy = (next_y + 0.5f) - ents->y[i];
+        }
 
-        if (distSq > 0.25f && distSq < 100.0f) {
-            float dist = sqrtf(distSq);
-            Game.enemies[i].x += (dx / dist) * 0.04f;
-            Game.enemies[i].y += (dy / dist) * 0.04f;
+        float dist = sqrtf(dx*dx + dy*dy);
+        if (dist > 0.001f) {
+            float step = ENEMY_MOVE_SPEED * think_dt / dist;
+            dx *= step;
+            dy *= step;
+        }
+
+        // Separation: push away from neighbours so a pack doesn't collapse into one sprite
+        int n = Spatial_QueryRadius(&Game.grid, ents, ents->x[i], ents->y[i],
+                                    ENEMY_SEPARATION_RADIUS, near, ENTITY_CAPACITY);
+        for (int k = 0; k < n && k < ENTITY_CAPACITY; k++) {
+            int j = near[k];
+            if (j == i) continue;
+
+            float ox = ents->x[i] - ents->x[j];
+            float oy = ents->y[i] - ents->y[j];
+            float od = sqrtf(ox*ox + oy*oy);
+            if (od < 0.001f) {
+                // Stacked exactly: split them by slot order so the result is deterministic
+                ox = (j < i) ? 1.0f : -1.0f;
+                oy = 0.0f;
+                od = 1.0f;
+            }
+            float push = (ENEMY_SEPARATION_RADIUS - od) / ENEMY_SEPARATION_RADIUS;
+            dx += ox / od * push * ENEMY_SEPARATION_SPEED * think_dt;
+            dy += oy / od * push * ENEMY_SEPARATION_SPEED * think_dt;
         }
 
-        if (distSq < 0.6f) {
-            Game.player.health -= 2;
+        Collision_MoveCircle(&ents->x[i], &ents->y[i], dx, dy, ENEMY_RADIUS);
+        Spatial_Move(&Game.grid, i, ents->x[i], ents->y[i]);
+
+        // Ranged attack: off cooldown, in the firing band and with a clear line to the player
+        if (Game.tick >= ents->fire_tick[i] &&
+            distSq > ENEMY_FIRE_MIN_RANGE * ENEMY_FIRE_MIN_RANGE &&
+            distSq < ENEMY_FIRE_RANGE * ENEMY_FIRE_RANGE &&
+            Rng_Range(&Game.rng_state, 100) < ENEMY_FIRE_CHANCE_PCT &&
+            Raycast_LineOfSight(ents->x[i], ents->y[i], target->x, target->y))
+        {
+            Projectile_Spawn(&Game.projectiles, ents->x[i], ents->y[i],
+                             target->x - ents->x[i], target->y - ents->y[i]);
+            ents->fire_tick[i] = Game.tick + ENEMY_FIRE_COOLDOWN_S * LOGIC_HZ;
         }
     }
+    else {
+        ents->state[i] = ENTITY_STATE_IDLE;
+    }
+}
+
+//
+// Thinks for every enemy in one burst (benchmarks / tools; the game uses the scheduler)
+//
+void Game_UpdateAI(void)
+{
+    ENTITY_FOREACH(&Game.entities, i) {
+        Game_ThinkEnemy(i, AI_TICK_INTERVAL);
+        Game.entities.think_tick[i] = Game.tick;
+    }
+}
 
-    if (Game.player.health <= 0) {
+//
+// World rules at AI_THINK_HZ: contact damage, level completion, arcade spawning
+//
+void Game_UpdateWorld(const InputSnapshot_t *input)
+{
+    EntityStore_t *ents = &Game.entities;
+
+    // Contact damage: only the cells around each player are visited
+    Player_t *live[2];
+    int n_live = LivePlayers(live);
+    for (int k = 0; k < n_live; k++) {
+        int touching = Spatial_QueryRadius(&Game.grid, ents, live[k]->x, live[k]->y,
+                                           ENEMY_CONTACT_RADIUS, NULL, 0);
+        live[k]->health -= touching * (ENEMY_CONTACT_DPS / AI_THINK_HZ);
+        if (touching && IsLocal(live[k])) Effects_Trigger(EFFECT_DAMAGE_FLASH);
+    }
+
+    // Over once nobody is left standing
+    if (LivePlayers(live) == 0) {
         Game.state = STATE_GAMEOVER;
         return;
     }
@@ -169,26 +467,23 @@ void Game_UpdateAI(void)
     // Progression
     if (Game.mode == MODE_CLASSIC)
     {
-        if (active_enemies == 0) {
+        if (ents->count == 0) {
             //  Trigger Transition instead of immediate load
             Game.state = STATE_LEVEL_TRANSITION;
-            Game.transition_timer = 250; // 50Hz * 5 seconds = 250 ticks
+            Game.transition_timer = LEVEL_TRANSITION_S * LOGIC_HZ;
         }
     }
     else if (Game.mode == MODE_ARCADE)
     {
-        if (active_enemies < 3) {
-            for(int i=0; i<5; i++) {
-                if (!Game.enemies[i].active) {
-                    Game.enemies[i].x = 2.0f + (rand() % 10);
-                    Game.enemies[i].y = 2.0f + (rand() % 10);
-
-                    if(Game.current_level->map[(int)Game.enemies[i].x][(int)Game.enemies[i].y] == 0) {
-                        Game.enemies[i].health = 3;
-                        Game.enemies[i].active = 1;
-                        break;
-                    }
-                }
+        // Population and spawn pace come from the frame-budget governor (via the input)
+        uint8_t cap = input->entity_cap ? input->entity_cap : ARCADE_MIN_ENEMIES;
+        uint8_t interval = input->spawn_interval ? input->spawn_interval : 1;
+        uint32_t think = Game.tick / AI_TICK_INTERVAL;
+
+        if (ents->count < cap && (think % interval) == 0) {
+            int cx, cy;
+            if (Spawn_PickCell(&Game.rng_state, &Game.grid, (int)Game.player.x, (int)Game.player.y, &cx, &cy)) {
+                Game_SpawnEnemy(cx + 0.5f, cy + 0.5f);
             }
         }
     }
@@ -211,3 +506,119 @@ void Game_HandleTransition(void)
         }
     }
 }
+
+//
+// Advances the simulation by one logic tick (PLAYING / LEVEL_TRANSITION)
+// Everything that steers the trajectory is read from 'input' or from Game,
+// so live play and replay run exactly the same code path.
+//
+void Game_Tick(const InputSnapshot_t *input)
+{
+    Game_TickLinked(input, NULL);
+}
+
+//
+// Linked runs: every board passes the same two inputs in the same order
+// (link.h), so all of them step through identical states. 'input' drives
+// Game.player and also carries the governor limits; 'partner_input' drives
+// Game.partner. NULL = single player.
+//
+void Game_TickLinked(const InputSnapshot_t *input, const InputSnapshot_t *partner_input)
+{
+    if (Game.state == STATE_PLAYING) {
+        Player_t *live[2];
+        float target_x[PROJECTILE_MAX_TARGETS], target_y[PROJECTILE_MAX_TARGETS];
+        uint8_t hits[PROJECTILE_MAX_TARGETS];
+
+        Game_Update(input);
+        Game_HandleCombat(input);
+        if (partner_input) {
+            MovePlayer(&Game.partner, partner_input);
+            PlayerShoot(&Game.partner, partner_input);
+            if (Session.local_player) Session.input_timestamp = partner_input->timestamp;
+        }
+
+        // Retargets on a cell change, then advances the BFS by a fixed budget
+        int n_live = LivePlayers(live);
+        if (n_live) {
+            const Player_t *b = live[n_live - 1];
+            FlowField_UpdatePair(&Game.flow, Game_Level(), (int)live[0]->x, (int)live[0]->y, (int)b->x, (int)b->y);
+        }
+
+        // A slice of the enemies thinks every tick; the world rules keep the 10Hz cadence
+        AiSched_Run(&Game.entities, &Game.ai_cursor, Game.tick, Game_ThinkEnemy);
+
+        for (int k = 0; k < n_live; k++) {
+            target_x[k] = live[k]->x;
+            target_y[k] = live[k]->y;
+        }
+        Projectile_Step(&Game.projectiles, target_x, target_y, n_live, hits);
+        for (int k = 0; k < n_live; k++) {
+            live[k]->health -= hits[k] * PROJECTILE_DAMAGE;
+            if (hits[k] && IsLocal(live[k])) Effects_Trigger(EFFECT_DAMAGE_FLASH);
+        }
+
+        if ((Game.tick + 1) % AI_TICK_INTERVAL == 0) {
+            Game_UpdateWorld(input);
+        }
+        else if (LivePlayers(live) == 0) {
+            Game.state = STATE_GAMEOVER;
+        }
+    }
+    else if (Game.state == STATE_LEVEL_TRANSITION) {
+        Game_HandleTransition();
+    }
+
+    Game.tick++;
+}
+
+//
+// FNV-1a over the simulation fields (used to verify replays tick for tick)
+//
+static uint32_t HashBytes(uint32_t h, const void *data, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t*)data;
+    while (len--) {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+uint32_t Game_StateHash(void)
+{
+    uint32_t h = 2166136261u;
+
+    h = HashBytes(h, &Game.state, sizeof(Game.state));
+    h = HashBytes(h, &Game.current_level_idx, sizeof(Game.current_level_idx));
+    h = HashBytes(h, &Game.player, sizeof(Game.player));
+    if (Game.linked) h = HashBytes(h, &Game.partner, sizeof(Game.partner));
+    h = HashBytes(h, &Game.current_score, sizeof(Game.current_score));
+    h = HashBytes(h, &Game.transition_timer, sizeof(Game.transition_timer));
+    h = HashBytes(h, &Game.tick, sizeof(Game.tick));
+    h = HashBytes(h, &Game.ai_cursor, sizeof(Game.ai_cursor));
+    h = HashBytes(h, &Game.rng_state, sizeof(Game.rng_state));
+
+    const EntityStore_t *ents = &Game.entities;
+    h = HashBytes(h, ents->active, sizeof(ents->active));
+    ENTITY_FOREACH(ents, i) {
+        h = HashBytes(h, &ents->x[i], sizeof(float));
+        h = HashBytes(h, &ents->y[i], sizeof(float));
+        h = HashBytes(h, &ents->health[i], sizeof(int16_t));
+        h = HashBytes(h, &ents->type[i], sizeof(uint8_t));
+        h = HashBytes(h, &ents->state[i], sizeof(uint8_t));
+        h = HashBytes(h, &ents->think_tick[i], sizeof(uint32_t));
+        h = HashBytes(h, &ents->fire_tick[i], sizeof(uint32_t));
+    }
+
+    const ProjectilePool_t *shots = &Game.projectiles;
+    h = HashBytes(h, &shots->active, sizeof(shots->active));
+    for (uint32_t bits = shots->active; bits; bits &= bits - 1) {
+        int i = __builtin_ctz(bits);
+        h = HashBytes(h, &shots->x[i], sizeof(float));
+        h = HashBytes(h, &shots->y[i], sizeof(float));
+        h = HashBytes(h, &shots->ttl[i], sizeof(uint16_t));
+    }
+
+    return h;
+}
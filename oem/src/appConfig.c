@@ -1,9 +1,8 @@
 #include "main.h"
 #include "appConfig.h"
 #include "stm32f4xx_hal.h" // Needed for Flash operations
-
-// Define the address for saving the high score (Sector 7 start)
-#define FLASH_STORAGE_ADDR 0x08060000
+#include "timing.h"
+#include "flashStore.h"
 
 
 // Default App Parameters
@@ -12,13 +11,28 @@ appConfig_t AppConfig = {
 		.appVersion = 0,
 		.invert_y_axis = 0,   // Standard controls by default
 		.sensitivity = 1.0f,  // Normal speed
-		.difficulty = 0       // Normal difficulty
+		.difficulty = 0,      // Normal difficulty
+		.joy_center_x = 2048, // Mid-scale until the boot auto-centre runs
+		.joy_center_y = 2048,
+		.joy_min_x = 2048 - 1024,
+		.joy_max_x = 2048 + 1024,
+		.joy_min_y = 2048 - 1024,
+		.joy_max_y = 2048 + 1024,
+		.joy_calibrated = 0
 };
 
 // Function to intiialise the appStatus
 void appInit()
 {
 	appStatus_t sc = APP_STATUS_OK;
+
+	// Start the cycle counter before any task timestamps input samples
+	Timing_Init();
+
+	// Index the persistent store and apply saved settings before any task reads them
+	FlashStore_Init();
+	LoadAppConfig();
+
 	// Check the app version and save file usage
 	sc = createTasks();
 	if(sc!= APP_STATUS_OK) {Error_Handler();}
@@ -28,43 +42,56 @@ void appInit()
 }
 
 //
-// Reads the high score from Flash Memory
+// Reads the high score through the flash store's RAM index (no flash walk)
 //
 uint32_t LoadHighScore(void)
 {
-	// Simply cast the address to a pointer and dereference it
-	uint32_t saved_score = *(__IO uint32_t*)FLASH_STORAGE_ADDR;
+	uint32_t saved_score = 0;
+	uint16_t len = sizeof(saved_score);
 
-	// If flash is empty, it reads as 0xFFFFFFFF. Return 150 (default) instead.
-	if (saved_score == 0xFFFFFFFF) {
+	if (FlashStore_Read(FS_KEY_HIGH_SCORE, &saved_score, &len) != FS_OK || len != sizeof(saved_score)) {
 		return 0;
 	}
 	return saved_score;
 }
 
 //
-// HARD SAVE: Erases flash sector and writes new score
+// Queues a new high score; it reaches flash on the next FlashStore_Commit()
 //
 void SaveHighScore(uint32_t new_score)
 {
-	HAL_FLASH_Unlock();
-
-	// 1. Erase Sector 7
-	FLASH_EraseInitTypeDef EraseInitStruct;
-	EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
-	EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-	EraseInitStruct.Sector = FLASH_SECTOR_7;
-	EraseInitStruct.NbSectors = 1;
-
-	uint32_t SectorError = 0;
-	if (HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError) != HAL_OK)
-	{
-		// Handle Error
-		HAL_FLASH_Lock();
-		return;
+	if (new_score <= LoadHighScore()) return;
+
+	FlashStore_Write(FS_KEY_HIGH_SCORE, &new_score, sizeof(new_score));
+}
+
+//
+// Settings: a stored copy is only trusted if it was written by the same layout
+//
+void LoadAppConfig(void)
+{
+	appConfig_t stored;
+	uint16_t len = sizeof(stored);
+
+	if (FlashStore_Read(FS_KEY_APP_CONFIG, &stored, &len) != FS_OK) return;
+	if (len != sizeof(stored) || stored.gameVersion != AppConfig.gameVersion) return;
+
+	// A calibration with the centre outside its own travel would invert an axis
+	if (stored.joy_min_x > stored.joy_center_x || stored.joy_max_x < stored.joy_center_x ||
+	    stored.joy_min_y > stored.joy_center_y || stored.joy_max_y < stored.joy_center_y) {
+		stored.joy_center_x = AppConfig.joy_center_x;
+		stored.joy_center_y = AppConfig.joy_center_y;
+		stored.joy_min_x = AppConfig.joy_min_x;
+		stored.joy_max_x = AppConfig.joy_max_x;
+		stored.joy_min_y = AppConfig.joy_min_y;
+		stored.joy_max_y = AppConfig.joy_max_y;
+		stored.joy_calibrated = 0;
 	}
 
-	HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, FLASH_STORAGE_ADDR, new_score);
+	AppConfig = stored;
+}
 
-	HAL_FLASH_Lock();
+void SaveAppConfig(void)
+{
+	FlashStore_Write(FS_KEY_APP_CONFIG, &AppConfig, sizeof(AppConfig));
 }
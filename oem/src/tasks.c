@@ -6,39 +6,56 @@
 #include "input.h"
 #include "display.h"
 #include "i2c.h"
+#include "latency.h"
+#include "replay.h"
+#include "renderState.h"
+#include "particles.h"
+#include "effects.h"
+#include "benchmark.h"
+#include "aiScheduler.h"
+#include "governor.h"
+#include "flashStore.h"
+#include "snapshot.h"
+#include "rollback.h"
+#include "link.h"
+#include "Menu.h"
+#include "timing.h"
 #include <string.h>
 #include <stdio.h>
+#include <math.h>
 
 // --- Config ---
 osThreadId_t inputTaskHandle;
 osThreadId_t gameLogicTaskHandle;
 osThreadId_t renderTaskHandle;
+osThreadId_t persistTaskHandle;
 
 #define InputTaskStackSize       512
 #define GameLogicTaskStackSize   4096
 #define RenderTaskStackSize      4096
+#define PersistTaskStackSize     1024
 
 // --- Sync ---
-osMessageQueueId_t xInputQueue;
 osMutexId_t gameMutex;
 
 // --- Prototypes ---
 void InputTask(void *params);
 void GameLogicTask(void *params);
 void RenderTask(void *params);
+void PersistTask(void *params);
 
 const taskConfig_t TaskRegistry[] = {
     {"Input",      InputTask,       osPriorityAboveNormal, InputTaskStackSize,       &inputTaskHandle},
     {"GameLogic",  GameLogicTask,   osPriorityNormal,      GameLogicTaskStackSize,   &gameLogicTaskHandle},
     {"Render",     RenderTask,      osPriorityBelowNormal, RenderTaskStackSize,      &renderTaskHandle},
+    {"Persist",    PersistTask,     osPriorityLow,         PersistTaskStackSize,     &persistTaskHandle},
 };
 
 #define TASK_COUNT (sizeof(TaskRegistry) / sizeof(taskConfig_t))
 
 appStatus_t createTasks(void) {
-    xInputQueue = osMessageQueueNew(16, sizeof(uint32_t), NULL);
     gameMutex = osMutexNew(NULL);
-    if (!xInputQueue || !gameMutex) return APP_STATUS_TASK_ERROR;
+    if (!gameMutex) return APP_STATUS_TASK_ERROR;
 
     for (int i = 0; i < TASK_COUNT; i++) {
         osThreadAttr_t attr = { .name = TaskRegistry[i].name, .priority = TaskRegistry[i].priority, .stack_size = TaskRegistry[i].stack_size };
@@ -50,6 +67,10 @@ appStatus_t createTasks(void) {
 
 static MenuOption_t selected_option = MENU_CLASSIC;
 
+// Co-op session (logic task, gameMutex held; the render task only reads its state)
+static LinkSession_t link;
+static LinkState_t   link_result = LINK_OFF;    // How the last linked run ended (end screen)
+
 // ---------------------------------------------------------
 // RENDER TASK
 // ---------------------------------------------------------
@@ -58,28 +79,74 @@ void RenderTask(void *params)
     I2C_Init();
     OLED_Init();
 
+    uint32_t prev_frame_start = Timing_Now();
+
     for(;;)
     {
+        // Input sample reflected by this frame (0 = not a gameplay frame)
+        uint32_t frame_input_stamp = 0;
+        uint8_t gameplay_frame = 0;
+        uint32_t draw_cycles = 0;
+        uint32_t frame_start = Timing_Now();
+        uint32_t frame_ms = Timing_CyclesToUs(frame_start - prev_frame_start) / 1000;
+        prev_frame_start = frame_start;
+
         if (osMutexAcquire(gameMutex, osWaitForever) == osOK)
         {
+            // Poses are sampled now: ticks published while we waited for the mutex count
+            uint32_t draw_start = Timing_Now();
+
+            // Effects age in wall-clock time, on every screen, so none linger into the next game
+            Effects_BeginFrame();
+            Particles_Step(frame_ms);
             ClearScreen();
 
             if (Game.state == STATE_MENU) {
-                UI_DrawMenu(selected_option);
+                UI_DrawMenu(selected_option, link.state == LINK_WAITING);
             }
             else if (Game.state == STATE_PLAYING) {
-                Render_3D_View();
-                Render_Enemies();
+                gameplay_frame = 1;
+                Camera_t cam;
+                SpritePos_t sprites[RENDER_MAX_SPRITES];
+                SpritePos_t shots[PROJECTILE_CAPACITY];
+                SpritePos_t ally;
+                RenderState_Interpolate(draw_start, &cam, sprites, shots, &ally);
+                frame_input_stamp = Session.input_timestamp;
+
+#if RENDER_LATE_LATCH
+                // Freshest sample wins: the facing comes from the newest tick plus the
+                // yaw commanded since, replacing the interpolated rotation
+                InputSample_t latest;
+                Camera_t latched;
+                Input_GetLatest(&latest);
+                Game_GetCamera(&latched);
+                if (Game_LateLatchCamera(&latched, &latest)) {
+                    cam.dir_x = latched.dir_x;
+                    cam.dir_y = latched.dir_y;
+                    cam.plane_x = latched.plane_x;
+                    cam.plane_y = latched.plane_y;
+                    frame_input_stamp = latest.timestamp;
+                }
+#endif
+
+                Effects_ApplyCamera(&cam);
+                Render_3D_View(&cam);
+                Render_Enemies(&cam, sprites, RENDER_MAX_SPRITES);
+                Render_Ally(&cam, &ally);
+                Render_Projectiles(&cam, shots, PROJECTILE_CAPACITY);
+                Render_Particles(&cam, Particles_Get());
 
                 char hudBuf[24];
+                int health = Game_LocalPlayer()->health;
                 if (Game.mode == MODE_ARCADE) {
                     // [UPDATED] Shows Health AND Score
-                    snprintf(hudBuf, sizeof(hudBuf), "HP:%d SC:%lu", Game.player.health, Game.current_score);
+                    snprintf(hudBuf, sizeof(hudBuf), "HP:%d SC:%lu", health, Game.current_score);
                 } else {
-                    snprintf(hudBuf, sizeof(hudBuf), "L%d HP:%d", Game.current_level_idx+1, Game.player.health);
+                    snprintf(hudBuf, sizeof(hudBuf), "L%d HP:%d", Game.current_level_idx+1, health);
                 }
                 DrawString(0, 0, hudBuf);
                 DrawChar(62, 30, '+');
+                Effects_Composite();
             }
             //  Transition Screen
             else if (Game.state == STATE_LEVEL_TRANSITION) {
@@ -90,7 +157,9 @@ void RenderTask(void *params)
             }
             else if (Game.state == STATE_GAMEOVER) {
                 DrawBigTitle(20, 20);
-                DrawString(30, 45, "YOU DIED");
+                if (link_result == LINK_LOST) DrawString(30, 45, "LINK LOST");
+                else if (link_result == LINK_DESYNC) DrawString(30, 45, "DESYNC");
+                else DrawString(30, 45, "YOU DIED");
 
                 char s[20];
                 snprintf(s, sizeof(s), "SCORE: %lu", Game.current_score);
@@ -106,10 +175,22 @@ void RenderTask(void *params)
                 DrawString(10, 55, s);
             }
 
+            // What the governor can shed: the mutex wait and the flush don't scale with enemies
+            draw_cycles = Timing_Now() - draw_start;
             osMutexRelease(gameMutex);
         }
 
         OLED_Update();
+
+        // Photon time: the frame is on the panel once the blocking flush returns
+        uint32_t flush_done = Timing_Now();
+        if (gameplay_frame) {
+            Governor_ReportRender(draw_cycles);
+        }
+        if (frame_input_stamp) {
+            Latency_RecordFrame(frame_input_stamp, flush_done);
+        }
+
         osDelay(33);
     }
 }
@@ -117,85 +198,292 @@ void RenderTask(void *params)
 // ---------------------------------------------------------
 // GAME LOGIC TASK
 // ---------------------------------------------------------
-void GameLogicTask(void *params)
+static LogicTimingStats_t logic_stats;
+static uint8_t b1_prev = 0;
+static int8_t menu_stick = 0;   // Last menu stick direction (-1 up, 1 down): one move per push
+
+// Ticks since the controls were last touched, and whether that idle spell was mirrored
+static uint32_t idle_ticks = 0;
+static uint8_t  idle_mirrored = 0;
+
+//
+// Keeps the suspend images current after a live tick: a RAM image every few
+// ticks, plus one flash copy per idle spell (no stick, no fire) since a flash
+// write, and the rare sector erase behind it, stalls every task.
+//
+static void Suspend_Update(const InputSnapshot_t *input)
 {
-    osMutexAcquire(gameMutex, osWaitForever);
-    Game_Init(MODE_CLASSIC);
-    Game.state = STATE_MENU;
-    osMutexRelease(gameMutex);
+    if (Replay_GetMode() == REPLAY_PLAYING) return;
+    if (Game.state != STATE_PLAYING && Game.state != STATE_LEVEL_TRANSITION) return;
 
-    uint8_t ai_tick_counter = 0;
-    int button_was_pressed = 0;
+    if (Game.tick % SNAPSHOT_RAM_INTERVAL == 0) {
+        Snapshot_SaveRam();
+    }
 
-    for(;;)
+    uint8_t touched = (Game.state == STATE_PLAYING) &&
+                      (fabsf(input->x) > STICK_DEADZONE || fabsf(input->y) > STICK_DEADZONE ||
+                       input->fire_held || input->fire_presses);
+    if (touched) {
+        idle_ticks = 0;
+        idle_mirrored = 0;
+    }
+    else if (++idle_ticks >= SNAPSHOT_IDLE_S * LOGIC_HZ && !idle_mirrored) {
+        Snapshot_MirrorToFlash();
+        FlashStore_Commit();
+        idle_mirrored = 1;
+    }
+}
+
+//
+// One fixed-length simulation step (LOGIC_DT). Also drives the menu and end
+// screens so every input edge is consumed on the same cadence.
+//
+static void GameLogic_Step(void)
+{
+    // One immutable input view per tick (axes + every fire edge since the last tick)
+    InputSnapshot_t input;
+    Input_BeginTick(&input);
+
+    // Load-dependent limits ride along with the input so replays see the same ones
+    input.entity_cap = Governor_EntityCap();
+    input.spawn_interval = Governor_SpawnInterval();
+
+    // Nucleo user button (B1, active low): replay from the menu / export after a run
+    uint8_t b1 = (HAL_GPIO_ReadPin(B1_GPIO_Port, B1_Pin) == GPIO_PIN_RESET);
+    uint8_t b1_pressed = b1 && !b1_prev;
+    b1_prev = b1;
+    uint8_t export_replay = 0;
+
+    if (osMutexAcquire(gameMutex, osWaitForever) == osOK)
     {
-        PlayerInput_t input = Input_ReadState();
+        if (Game.state == STATE_MENU) {
+            int8_t stick = (input.y < -0.5f) ? 1 : (input.y > 0.5f) ? -1 : 0;
+            if (stick && stick != menu_stick && link.state == LINK_OFF) {
+                int option = (int)selected_option + stick;
+                if (option >= MENU_CLASSIC && option <= MENU_LINK) selected_option = (MenuOption_t)option;
+            }
+            menu_stick = stick;
 
-        if (osMutexAcquire(gameMutex, osWaitForever) == osOK)
-        {
-            if (Game.state == STATE_MENU) {
-                if (input.y < -0.5f) selected_option = MENU_ARCADE;
-                else if (input.y > 0.5f) selected_option = MENU_CLASSIC;
+            GameMode_t mode;
+            uint32_t seed;
 
-                if (input.is_firing && !button_was_pressed) {
-                    if (selected_option == MENU_CLASSIC) Game_Init(MODE_CLASSIC);
-                    else Game_Init(MODE_ARCADE);
+            if (link.state == LINK_WAITING) {
+                // Fire again backs out of the handshake
+                if (input.fire_presses) {
+                    Link_Stop(&link);
+                }
+                else if (Link_Service(&link) == LINK_RUNNING) {
+                    Game_InitLinked((GameMode_t)link.mode, link.seed, link.side);
                     Game.state = STATE_PLAYING;
+                    RenderState_Reset();
+#if ENABLE_ROLLBACK
+                    Rollback_Reset();
+#endif
+                    // Both boards must think the same enemies every tick
+                    AiSched_SetMode(AI_SCHED_QUOTA);
                 }
             }
-            else if (Game.state == STATE_PLAYING) {
-                Game_Update();
-                Game_HandleCombat();
+            else if (input.fire_presses && selected_option == MENU_LINK) {
+                Link_Start(&link, LinkUart_Init(), MODE_CLASSIC, Timing_Now());
+            }
+            else if (input.fire_presses) {
+                mode = (selected_option == MENU_CLASSIC) ? MODE_CLASSIC : MODE_ARCADE;
+                seed = Timing_Now();
+                Game_Init(mode, seed);
+                Game.state = STATE_PLAYING;
+                RenderState_Reset();
+#if ENABLE_ROLLBACK
+                Rollback_Reset();
+#endif
+#if REPLAY_AUTO_RECORD
+                Replay_StartRecording(mode, seed);
+#endif
+                // The recording keeps the budget's stops, so recorded runs still replay exactly
+                AiSched_SetMode(AI_SCHED_BUDGET);
+            }
+            else if (b1_pressed && Replay_StartPlayback(&mode, &seed)) {
+                Game_Init(mode, seed);
+                Game.state = STATE_PLAYING;
+                RenderState_Reset();
+#if ENABLE_ROLLBACK
+                Rollback_Reset();
+#endif
+                AiSched_SetMode(AI_SCHED_QUOTA);
+            }
+        }
+        else if ((Game.state == STATE_PLAYING || Game.state == STATE_LEVEL_TRANSITION) && Game.linked) {
+            // Lockstep: a tick runs only once both inputs for it are in. Linked runs
+            // are neither recorded, rolled back nor suspended (the peer can't resume).
+            InputSnapshot_t p0, p1;
+            if (Link_Service(&link) == LINK_RUNNING && Link_NextTick(&link, &input, &p0, &p1)) {
+                uint32_t tick_start = Timing_Now();
+                Game_TickLinked(&p0, &p1);
+                Governor_ReportLogic(Timing_Now() - tick_start);
+                Governor_Update();
 
-                if (++ai_tick_counter >= 5) {
-                    Game_UpdateAI();
-                    ai_tick_counter = 0;
-                }
+                Link_EndTick(&link);
+                RenderState_Publish();
             }
-            //  Handle Transition Logic
-            else if (Game.state == STATE_LEVEL_TRANSITION) {
-                Game_HandleTransition();
+
+            if (link.state == LINK_LOST || link.state == LINK_DESYNC) {
+                Game.state = STATE_GAMEOVER;
             }
-            else if (Game.state == STATE_GAMEOVER || Game.state == STATE_VICTORY) {
-                 if (input.is_firing && !button_was_pressed) {
-                    Game.state = STATE_MENU;
-                 }
+            if (Game.state == STATE_GAMEOVER || Game.state == STATE_VICTORY) {
+                // A link lost later, once the peer leaves its end screen, doesn't rewrite this one
+                link_result = link.state;
+                SaveHighScore(Game.high_score);
+                FlashStore_CommitReserve();
+            }
+        }
+        else if (Game.state == STATE_PLAYING || Game.state == STATE_LEVEL_TRANSITION) {
+            if (Replay_BeginTick(&input)) {
+                uint32_t tick_start = Timing_Now();
+#if ENABLE_ROLLBACK
+                Rollback_SaveTick(&input);
+#endif
+                Game_Tick(&input);
+                Governor_ReportLogic(Timing_Now() - tick_start);
+                Governor_Update();
+
+                Replay_EndTick();
+                RenderState_Publish();
+                Suspend_Update(&input);
+            }
+            else {
+                // Playback ran out before the run ended
+                Game.state = STATE_MENU;
+            }
+
+            if (Game.state == STATE_GAMEOVER || Game.state == STATE_VICTORY) {
+                Replay_StopRecording();
+
+                // Run over: a stall from a sector erase is harmless on the end screen,
+                // so any erase the next run's idle mirrors would need happens here
+                Snapshot_Invalidate();
+                SaveHighScore(Game.high_score);
+                FlashStore_CommitReserve();
             }
-            osMutexRelease(gameMutex);
         }
+        else if (Game.state == STATE_GAMEOVER || Game.state == STATE_VICTORY) {
+             // Keepalives carry any inputs the peer still lacks to finish its last tick
+             if (Game.linked) Link_Service(&link);
 
-        button_was_pressed = input.is_firing;
-        osDelay(20);
+             if (input.fire_presses) {
+                Link_Stop(&link);
+                link_result = LINK_OFF;
+                Replay_StopPlayback();
+                Game.state = STATE_MENU;
+             }
+             else if (b1_pressed && Replay_GetMode() == REPLAY_IDLE && !Game.linked) {
+                export_replay = 1;
+             }
+        }
+        osMutexRelease(gameMutex);
+    }
+
+    // Blocking UART transfer: never while holding the game mutex
+    if (export_replay) {
+        Replay_ExportUart();
+    }
+
+    logic_stats.ticks++;
+}
+
+void Logic_GetTimingStats(LogicTimingStats_t *stats)
+{
+    *stats = logic_stats;
+}
+
+void GameLogicTask(void *params)
+{
+    osMutexAcquire(gameMutex, osWaitForever);
+#if ENABLE_BENCHMARKS
+    Benchmark_RunEntityScaling();
+    Benchmark_RunProjectiles();
+    Benchmark_ExportUart();
+#endif
+    Governor_Reset();
+
+    // A reset mid-run (or a power cycle after an idle mirror) goes straight back in
+    if (Snapshot_Resume()) {
+        RenderState_Reset();
+#if ENABLE_ROLLBACK
+        Rollback_Reset();
+#endif
+        AiSched_SetMode(AI_SCHED_BUDGET);
+    }
+    else {
+        Game_Init(MODE_CLASSIC, Timing_Now());
+        Game.state = STATE_MENU;
+    }
+    osMutexRelease(gameMutex);
+
+    // Absolute deadline of the next tick; advancing it by a fixed step (instead of
+    // delaying after the work) keeps the 50Hz grid from drifting with logic time
+    uint32_t next_tick = osKernelGetTickCount();
+
+    for(;;)
+    {
+        // Run every tick whose deadline has passed, up to the substep cap
+        uint32_t substeps = 0;
+        while ((int32_t)(osKernelGetTickCount() - next_tick) >= 0 && substeps < LOGIC_MAX_SUBSTEPS)
+        {
+            GameLogic_Step();
+            next_tick += LOGIC_TICK_MS;
+            substeps++;
+        }
+
+        if (substeps > 1) logic_stats.overruns++;
+        if (substeps > logic_stats.max_substeps) logic_stats.max_substeps = substeps;
+
+        // Still behind after the cap: skip the backlog instead of spiralling
+        int32_t behind = (int32_t)(osKernelGetTickCount() - next_tick);
+        if (behind >= 0) {
+            uint32_t skipped = (uint32_t)behind / LOGIC_TICK_MS + 1;
+            logic_stats.dropped_ticks += skipped;
+            next_tick += skipped * LOGIC_TICK_MS;
+        }
+
+        osDelayUntil(next_tick);
     }
 }
 
 // ---------------------------------------------------------
-// INPUT TASK (Unchanged)
+// INPUT TASK
 // ---------------------------------------------------------
 void InputTask(void *params)
 {
-    // Hardware Init (Starts the DMA in background)
+    // Hardware Init (Starts the timer-triggered DMA in background)
     Input_Init();
 
-    // Setup Timing (50Hz / 20ms)
-    const uint32_t frequency = 20;
-    uint32_t tick = osKernelGetTickCount();
+    // Each completed half-buffer (every 10 ms) wakes us; the timeout only
+    // matters if the ADC stops, in which case the last sample is republished.
+    const uint32_t timeout = 50;
 
     for(;;)
     {
-        // DMA has already updated these variables for us
-        uint32_t raw_x = ADC_GetX();
-        uint32_t raw_y = ADC_GetY();
-        uint8_t  btn   = ADC_ReadButton();
+        osThreadFlagsWait(ADC_FLAG_HALF | ADC_FLAG_FULL, osFlagsWaitAny, timeout);
+
+        // Average + filter the block DMA just finished and publish it
+        Input_Poll();
+    }
+}
 
-        uint32_t packet = 0;
-        packet |= (raw_x & 0xFFF);
-        packet |= ((raw_y & 0xFFF) << 12);
-        packet |= ((uint32_t)(btn & 0x1) << 24);
+// ---------------------------------------------------------
+// PERSIST TASK
+// ---------------------------------------------------------
+void PersistTask(void *params)
+{
+    // Commits wake this thread; everything else outranks it while flash is busy
+    FlashStore_AttachTask();
 
-        osMessageQueuePut(xInputQueue, &packet, 0, 0);
+    // Writes queued before this thread could be woken (the higher-priority input
+    // task saves its boot auto-centre straight away)
+    FlashStore_Flush();
 
-        tick += frequency;
-        osDelayUntil(tick);
+    for(;;)
+    {
+        osThreadFlagsWait(FLASH_STORE_FLAG_COMMIT, osFlagsWaitAny, osWaitForever);
+        FlashStore_Flush();
     }
 }